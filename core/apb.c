@@ -3,7 +3,9 @@
 #include "apb.h"
 #include "mem.h"
 #include "emu.h"
+#include "perf.h"
 #include "debug/debug.h"
+#include "debug/iotrace.h"
 
 /* Global APB state */
 apb_map_entry_t apb_map[0x10];
@@ -14,12 +16,20 @@ void apb_set_map(int entry, eZ80portrange_t *range){
 
 uint8_t port_read_byte(const uint16_t addr) {
     uint16_t port = (port_range(addr) << 12) | addr_range(addr);
+    uint8_t value;
 #ifdef DEBUG_SUPPORT
     if (debugger.data.ports[port] & DBG_PORT_READ) {
         open_debugger(HIT_PORT_READ_BREAKPOINT, port);
     }
 #endif
-    return apb_map[port_range(addr)].range->read_in(addr_range(addr));
+    perf.mmio_reads[port_range(addr)]++;
+    value = apb_map[port_range(addr)].range->read_in(addr_range(addr));
+#ifdef DEBUG_SUPPORT
+    if (iotrace.reads >> port_range(addr) & 1) {
+        iotrace_access(port, value, false);
+    }
+#endif
+    return value;
 }
 
 void port_write_byte(const uint16_t addr, const uint8_t value) {
@@ -31,6 +41,12 @@ void port_write_byte(const uint16_t addr, const uint8_t value) {
     }
 #endif
 
+    perf.mmio_writes[port_range(addr)]++;
+#ifdef DEBUG_SUPPORT
+    if (iotrace.writes >> port_range(addr) & 1) {
+        iotrace_access(port, value, true);
+    }
+#endif
     apb_map[port_range(addr)].range->write_out(addr_range(addr), value);
 
 #ifdef DEBUG_SUPPORT
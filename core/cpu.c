@@ -26,7 +26,14 @@
 #include "mem.h"
 #include "registers.h"
 #include "interrupt.h"
+#include "perf.h"
 #include "debug/debug.h"
+#include "debug/disasm.h"
+#include "debug/profiler.h"
+#include "debug/trace.h"
+#include "debug/coverage.h"
+#include "debug/iotrace.h"
+#include "debug/timeline.h"
 
 /* Global CPU state */
 eZ80cpu_t cpu;
@@ -347,18 +354,24 @@ static void cpu_write_rp3(int i, uint32_t value) {
 }
 
 static bool cpu_read_cc(const int i) {
+    bool cc;
     switch (i) {
-        case 0: return !cpu.registers.flags.Z;
-        case 1: return  cpu.registers.flags.Z;
-        case 2: return !cpu.registers.flags.C;
-        case 3: return  cpu.registers.flags.C;
-        case 4: return !cpu.registers.flags.PV;
-        case 5: return  cpu.registers.flags.PV;
-        case 6: return !cpu.registers.flags.S;
-        case 7: return  cpu.registers.flags.S;
+        case 0: cc = !cpu.registers.flags.Z; break;
+        case 1: cc =  cpu.registers.flags.Z; break;
+        case 2: cc = !cpu.registers.flags.C; break;
+        case 3: cc =  cpu.registers.flags.C; break;
+        case 4: cc = !cpu.registers.flags.PV; break;
+        case 5: cc =  cpu.registers.flags.PV; break;
+        case 6: cc = !cpu.registers.flags.S; break;
+        case 7: cc =  cpu.registers.flags.S; break;
         default: abort();
     }
-    return true;
+#ifdef DEBUG_SUPPORT
+    if (coverage.active) {
+        coverage_branch(cc);
+    }
+#endif
+    return cc;
 }
 
 static void cpu_execute_daa(void) {
@@ -433,10 +446,20 @@ static void cpu_call(uint32_t address, bool mixed) {
         cpu_push_word(r->PC);
     }
     cpu_prefetch(address, cpu.IL);
+#ifdef DEBUG_SUPPORT
+    if (profiler.mode != PROFILER_OFF) {
+        profiler_call(mixed || cpu.L);
+    }
+#endif
 }
 
 static void cpu_trap_rewind(uint_fast8_t rewind) {
     eZ80registers_t *r = &cpu.registers;
+#ifdef DEBUG_SUPPORT
+    if (trace.active) {
+        trace_event(TRACE_SAVE_TRAP);
+    }
+#endif
     cpu_fetch_byte();
     cpu.cycles++;
     r->PC = cpu_mask_mode(r->PC - 1 - rewind, cpu.ADL);
@@ -481,6 +504,14 @@ static void cpu_return(void) {
         address = cpu_pop_word();
     }
     cpu_prefetch(address, mode);
+#ifdef DEBUG_SUPPORT
+    if (profiler.mode != PROFILER_OFF) {
+        profiler_return();
+    }
+    if (timeline.active) {
+        timeline_return();
+    }
+#endif
     cpu_check_step_out();
 }
 
@@ -865,6 +896,15 @@ void cpu_execute(void) {
             cpu_clear_mode();
             cpu.IEF1 = cpu.IEF2 = cpu.halted = cpu.inBlock = 0;
             cpu.cycles += 1;
+            perf.interrupts++;
+#ifdef DEBUG_SUPPORT
+            if (trace.active) {
+                trace_interrupt();
+            }
+            if (timeline.active) {
+                timeline_interrupt(cpu.NMI ? TIMELINE_NMI : intrpt.request->status & intrpt.request->enabled);
+            }
+#endif
             if (cpu.NMI) {
                 cpu.NMI = 0;
                 cpu_call(0x66, cpu.MADL);
@@ -890,6 +930,26 @@ void cpu_execute(void) {
             goto cpu_execute_bli_continue;
         }
         do {
+#ifdef DEBUG_SUPPORT
+            if (debug_hooks && !cpu.PREFIX && !cpu.SUFFIX) {
+                if (debug_hooks & DBG_HOOK_PROFILER) {
+                    if (profiler.mode == PROFILER_EXACT) {
+                        profiler_instruction(r->PC);
+                    } else {
+                        profiler.pc = r->PC;
+                    }
+                }
+                if (debug_hooks & DBG_HOOK_TRACE) {
+                    trace_instruction(r->PC);
+                }
+                if (debug_hooks & DBG_HOOK_COVERAGE) {
+                    coverage_instruction(r->PC);
+                }
+                if (debug_hooks & DBG_HOOK_IOTRACE) {
+                    iotrace.pc = r->PC;
+                }
+            }
+#endif
             // fetch opcode
             context.opcode = cpu_fetch_byte();
             r->R += 2;
@@ -907,6 +967,11 @@ void cpu_execute(void) {
                                     break;
                                 case 2: // DJNZ d
                                     s = cpu_fetch_offset();
+#ifdef DEBUG_SUPPORT
+                                    if (coverage.active) {
+                                        coverage_branch(r->B != 1);
+                                    }
+#endif
                                     if (--r->B) {
                                         cpu.cycles++;
                                         cpu_prefetch(cpu_mask_mode((int32_t)r->PC + s, cpu.L), cpu.ADL);
@@ -1478,6 +1543,9 @@ void cpu_execute(void) {
                                                             break;
                                                         case 0xEE: // flash erase
                                                             memset(mem.flash.block + (r->HL & ~0x3FFF), 0xFF, 0x4000);
+#ifdef DEBUG_SUPPORT
+                                                            disasm_cache_flush();
+#endif
                                                             break;
                                                         default:   // OPCODETRAP
                                                             cpu_trap();
@@ -1506,6 +1574,7 @@ void cpu_execute(void) {
                     }
                     break;
             }
+            perf.instructions++;
             cpu_clear_mode();
         } while (cpu.PREFIX || cpu.SUFFIX || cpu.cycles < cpu.next);
     }
@@ -0,0 +1,617 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "analysis.h"
+#include "opcodes.h"
+#include "../mem.h"
+#include "../emu.h"
+#include "../os/os.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define analysis_load_flag(ptr) ((uint32_t)InterlockedCompareExchange((volatile LONG *)(ptr), 0, 0))
+#define analysis_store_flag(ptr, value) InterlockedExchange((volatile LONG *)(ptr), (LONG)(value))
+#else
+#define analysis_load_flag(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define analysis_store_flag(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif
+
+#define ANALYSIS_VERSION     2
+#define ANALYSIS_TABLE_MIN   16     /* Consecutive "jp nnnnnn" entries taken to be a jump table */
+
+analysis_t analysis;
+void (*analysis_gui_callback)(void) = NULL;
+
+typedef enum {
+    FLOW_NEXT,          /* Carries on with the next instruction */
+    FLOW_BRANCH,        /* Carries on, or goes to the target */
+    FLOW_CALL,          /* Goes to the target and usually comes back */
+    FLOW_JUMP,          /* Only goes to the target */
+    FLOW_RETURN,
+    FLOW_STOP           /* Goes somewhere that can't be known from the bytes */
+} analysis_flow_t;
+
+typedef struct {
+    uint32_t size;
+    analysis_flow_t flow;
+    bool has_target, target_adl, has_data;
+    uint32_t target;
+    uint32_t data;
+} analysis_inst_t;
+
+typedef struct {
+    void *data;
+    uint32_t count, capacity;
+} analysis_list_t;
+
+/*
+ * The worker owns the job until it sets done; the GUI thread then takes the results. Setting stop makes the
+ * worker give up early, and the GUI thread waits for it before freeing anything.
+ */
+typedef struct {
+    uint8_t *rom;
+    uint64_t hash;
+    char *path;
+    analysis_t result;
+    uint32_t done;
+    uint32_t stop;
+    os_thread_t *thread;
+} analysis_job_t;
+
+static analysis_job_t *analysis_job = NULL;
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t size;
+    uint64_t hash;
+    uint32_t function_count;
+    uint32_t xref_count;
+    uint32_t flags_length;          /* Run length encoded, as value and LEB128 count pairs */
+    uint32_t reserved;
+} analysis_header_t;
+
+static const char analysis_magic[8] = { 'C', 'E', 'm', 'u', 'A', 'N', 'L', 0 };
+
+static bool analysis_push(analysis_list_t *list, const void *item, uint32_t size) {
+    if (list->count == list->capacity) {
+        uint32_t capacity = list->capacity ? list->capacity * 2 : 1024;
+        void *data = realloc(list->data, (size_t)capacity * size);
+        if (!data) {
+            return false;
+        }
+        list->data = data;
+        list->capacity = capacity;
+    }
+    memcpy((uint8_t *)list->data + (size_t)list->count++ * size, item, size);
+    return true;
+}
+
+static uint64_t analysis_hash(const uint8_t *rom) {
+    uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    uint32_t i;
+    for (i = 0; i < ANALYSIS_SIZE; i++) {
+        hash = (hash ^ rom[i]) * UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+
+/* Decoding, just far enough to know the size of an instruction and where it can go next */
+static uint8_t analysis_byte(void *rom, uint32_t address) {
+    return address < ANALYSIS_SIZE ? ((const uint8_t *)rom)[address] : 0xFF;
+}
+
+static void analysis_target(analysis_inst_t *inst, uint32_t address, uint32_t value, bool adl, bool target_adl) {
+    if (target_adl) {
+        inst->target = value & 0xFFFFFF;
+    } else if (!adl) {
+        inst->target = (address & 0xFF0000) | (value & 0xFFFF);
+    } else {
+        return;     /* Switching to Z80 mode depends on MBASE */
+    }
+    inst->has_target = true;
+    inst->target_adl = target_adl;
+}
+
+static void analysis_decode(const uint8_t *rom, uint32_t address, bool adl, analysis_inst_t *inst) {
+    const opcode_t *opcode;
+    opcode_inst_t op;
+
+    memset(inst, 0, sizeof(*inst));
+    opcode_decode(&op, address, adl, analysis_byte, (void *)rom);
+    opcode = op.opcode;
+    inst->size = op.size;
+
+    switch (opcode->flow) {
+        case OPCODE_FLOW_JUMP:
+            inst->flow = opcode->flags & OPCODE_CONDITIONAL ? FLOW_BRANCH : FLOW_JUMP;
+            break;
+        case OPCODE_FLOW_CALL:
+            inst->flow = FLOW_CALL;
+            break;
+        case OPCODE_FLOW_RETURN:
+            inst->flow = opcode->flags & OPCODE_CONDITIONAL ? FLOW_NEXT : FLOW_RETURN;
+            break;
+        case OPCODE_FLOW_INDIRECT:
+        case OPCODE_FLOW_TRAP:
+            inst->flow = FLOW_STOP;
+            break;
+        default:
+            inst->flow = FLOW_NEXT;
+            break;
+    }
+
+    if (opcode->kind == OPCODE_RELATIVE) {
+        analysis_target(inst, address, op.word, adl, adl);
+    } else if (opcode->kind == OPCODE_RESTART) {
+        analysis_target(inst, address, op.word, adl, op.il);
+    } else if (opcode->kind == OPCODE_WORD && opcode->flow != OPCODE_FLOW_NEXT) {
+        /* Jumps take the data size, calls the immediate size */
+        analysis_target(inst, address, op.word, adl, opcode->flow == OPCODE_FLOW_CALL ? op.il : op.l);
+    } else if (opcode->kind == OPCODE_WORD) {
+        inst->data = op.word;
+        inst->has_data = op.il;
+    }
+}
+
+/* Following the code */
+static bool analysis_follow(analysis_job_t *job, analysis_list_t *work, analysis_list_t *xrefs, uint32_t address, bool adl) {
+    uint8_t *flags = job->result.flags;
+    analysis_inst_t inst;
+    analysis_xref_t xref;
+    uint32_t entry, i;
+
+    while (address < ANALYSIS_SIZE && !(flags[address] & ANALYSIS_START)) {
+        analysis_decode(job->rom, address, adl, &inst);
+        if (address + inst.size > ANALYSIS_SIZE) {
+            break;
+        }
+        flags[address] |= ANALYSIS_START | (adl ? ANALYSIS_ADL : 0);
+        for (i = 0; i < inst.size; i++) {
+            flags[address + i] |= ANALYSIS_CODE;
+        }
+
+        xref.from = address;
+        if (inst.has_data && inst.data < ANALYSIS_SIZE) {
+            xref.to = inst.data;
+            xref.kind = ANALYSIS_XREF_DATA;
+            if (!analysis_push(xrefs, &xref, sizeof(xref))) {
+                return false;
+            }
+        }
+        if (inst.has_target) {
+            xref.to = inst.target;
+            xref.kind = inst.flow == FLOW_CALL ? ANALYSIS_XREF_CALL : ANALYSIS_XREF_JUMP;
+            if (!analysis_push(xrefs, &xref, sizeof(xref))) {
+                return false;
+            }
+            if (inst.target < ANALYSIS_SIZE) {
+                flags[inst.target] |= inst.flow == FLOW_CALL ? ANALYSIS_FUNCTION : ANALYSIS_TARGET;
+                entry = inst.target | (uint32_t)inst.target_adl << 24;
+                if (!analysis_push(work, &entry, sizeof(entry))) {
+                    return false;
+                }
+            }
+        }
+
+        if (inst.flow == FLOW_JUMP || inst.flow == FLOW_RETURN || inst.flow == FLOW_STOP) {
+            break;
+        }
+        /* Z80 mode code wraps around within its 64K */
+        address = adl ? address + inst.size : (address & 0xFF0000) | ((address + inst.size) & 0xFFFF);
+    }
+    return true;
+}
+
+static bool analysis_seed(analysis_list_t *work, uint8_t *flags, uint32_t address, bool adl, uint8_t kind) {
+    uint32_t entry = address | (uint32_t)adl << 24;
+    flags[address] |= kind;
+    return analysis_push(work, &entry, sizeof(entry));
+}
+
+static bool analysis_seed_tables(analysis_job_t *job, analysis_list_t *work) {
+    const uint8_t *rom = job->rom;
+    uint32_t address, run, i;
+
+    for (address = 0; address + 4 <= ANALYSIS_SIZE; address += run ? run * 4 : 1) {
+        for (run = 0; address + run * 4 + 4 <= ANALYSIS_SIZE; run++) {
+            const uint8_t *entry = rom + address + run * 4;
+            if (entry[0] != 0xC3 || (uint32_t)(entry[1] | entry[2] << 8 | entry[3] << 16) >= ANALYSIS_SIZE) {
+                break;
+            }
+        }
+        if (run < ANALYSIS_TABLE_MIN) {
+            run = 0;
+            continue;
+        }
+        for (i = 0; i < run; i++) {
+            const uint8_t *entry = rom + address + i * 4;
+            if (!analysis_seed(work, job->result.flags, address + i * 4, true, ANALYSIS_TARGET) ||
+                !analysis_seed(work, job->result.flags, entry[1] | entry[2] << 8 | entry[3] << 16, true, ANALYSIS_FUNCTION)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* A function ends after the furthest instruction reached from its start without calling or going into another one, or where the next one starts */
+static bool analysis_functions(analysis_job_t *job, analysis_list_t *functions) {
+    const uint8_t *flags = job->result.flags;
+    analysis_list_t work = { NULL, 0, 0 };
+    uint32_t *visited = calloc(ANALYSIS_SIZE, sizeof(uint32_t));
+    analysis_function_t function;
+    analysis_inst_t inst;
+    uint32_t start, address, stamp = 0;
+    bool ok = visited != NULL;
+
+    for (start = 0; ok && start < ANALYSIS_SIZE; start++) {
+        if ((flags[start] & (ANALYSIS_FUNCTION | ANALYSIS_START)) != (ANALYSIS_FUNCTION | ANALYSIS_START)) {
+            continue;
+        }
+        if (analysis_load_flag(&job->stop)) {
+            ok = false;
+            break;
+        }
+        stamp++;
+        function.start = start;
+        function.end = start;
+        work.count = 0;
+        ok = analysis_push(&work, &start, sizeof(start));
+        while (ok && work.count) {
+            address = ((uint32_t *)work.data)[--work.count];
+            while (address < ANALYSIS_SIZE && (flags[address] & ANALYSIS_START) && visited[address] != stamp &&
+                   (address == start || !(flags[address] & ANALYSIS_FUNCTION))) {
+                visited[address] = stamp;
+                analysis_decode(job->rom, address, flags[address] & ANALYSIS_ADL, &inst);
+                if (address + inst.size > function.end) {
+                    function.end = address + inst.size;
+                }
+                if ((inst.flow == FLOW_BRANCH || inst.flow == FLOW_JUMP) && inst.has_target &&
+                    !(ok = analysis_push(&work, &inst.target, sizeof(inst.target)))) {
+                    break;
+                }
+                if (inst.flow == FLOW_JUMP || inst.flow == FLOW_RETURN || inst.flow == FLOW_STOP) {
+                    break;
+                }
+                address += inst.size;
+            }
+        }
+        ok = ok && analysis_push(functions, &function, sizeof(function));
+    }
+
+    /* Shared tails go to the function that comes first, so every address is in at most one */
+    for (start = 1; ok && start < functions->count; start++) {
+        analysis_function_t *list = functions->data;
+        if (list[start - 1].end > list[start].start) {
+            list[start - 1].end = list[start].start;
+        }
+    }
+
+    free(work.data);
+    free(visited);
+    return ok;
+}
+
+static int analysis_xref_compare(const void *a, const void *b) {
+    const analysis_xref_t *x = a, *y = b;
+    if (x->to != y->to) {
+        return x->to < y->to ? -1 : 1;
+    }
+    if (x->from != y->from) {
+        return x->from < y->from ? -1 : 1;
+    }
+    return (int)x->kind - (int)y->kind;
+}
+
+static bool analysis_run(analysis_job_t *job) {
+    analysis_list_t work = { NULL, 0, 0 }, xrefs = { NULL, 0, 0 }, functions = { NULL, 0, 0 };
+    uint8_t *flags;
+    uint32_t entry, i;
+    bool ok;
+
+    flags = job->result.flags = calloc(ANALYSIS_SIZE, 1);
+    ok = flags != NULL;
+
+    /* The reset vector runs in Z80 mode; the OS handles RSTs and the NMI in ADL mode */
+    ok = ok && analysis_seed(&work, flags, 0, false, ANALYSIS_FUNCTION);
+    for (i = 8; ok && i <= 0x38; i += 8) {
+        ok = analysis_seed(&work, flags, i, true, ANALYSIS_FUNCTION);
+    }
+    ok = ok && analysis_seed(&work, flags, 0x66, true, ANALYSIS_FUNCTION);
+    ok = ok && analysis_seed_tables(job, &work);
+
+    while (ok && work.count) {
+        if (analysis_load_flag(&job->stop)) {
+            ok = false;
+            break;
+        }
+        entry = ((uint32_t *)work.data)[--work.count];
+        ok = analysis_follow(job, &work, &xrefs, entry & 0xFFFFFF, entry >> 24);
+    }
+
+    if (ok) {
+        analysis_xref_t *list = xrefs.data;
+        for (i = 0; i < xrefs.count; i++) {
+            if (list[i].kind == ANALYSIS_XREF_DATA && !(flags[list[i].to] & ANALYSIS_CODE)) {
+                flags[list[i].to] |= ANALYSIS_DATA;
+            }
+        }
+        qsort(xrefs.data, xrefs.count, sizeof(analysis_xref_t), analysis_xref_compare);
+        ok = analysis_functions(job, &functions);
+    }
+
+    free(work.data);
+    job->result.xrefs = xrefs.data;
+    job->result.xref_count = xrefs.count;
+    job->result.functions = functions.data;
+    job->result.function_count = functions.count;
+    return ok;
+}
+
+/* Saving and loading */
+static void analysis_free_result(analysis_t *result) {
+    free(result->flags);
+    free(result->functions);
+    free(result->xrefs);
+    memset(result, 0, sizeof(*result));
+}
+
+static bool analysis_save(const analysis_t *result, const char *path) {
+    analysis_header_t header;
+    uint8_t *rle = malloc(ANALYSIS_SIZE * 2);
+    uint32_t length = 0, i, run, count;
+    FILE *file;
+    bool ok;
+
+    if (!rle) {
+        return false;
+    }
+    for (i = 0; i < ANALYSIS_SIZE; i += run) {
+        for (run = 1; i + run < ANALYSIS_SIZE && result->flags[i + run] == result->flags[i]; run++);
+        rle[length++] = result->flags[i];
+        for (count = run; ; count >>= 7) {
+            rle[length++] = (count & 0x7F) | (count > 0x7F ? 0x80 : 0);
+            if (count <= 0x7F) {
+                break;
+            }
+        }
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, analysis_magic, sizeof(header.magic));
+    header.version = ANALYSIS_VERSION;
+    header.size = ANALYSIS_SIZE;
+    header.hash = result->hash;
+    header.function_count = result->function_count;
+    header.xref_count = result->xref_count;
+    header.flags_length = length;
+
+    if (!(file = fopen_utf8(path, "wb"))) {
+        free(rle);
+        return false;
+    }
+    ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+         fwrite(rle, 1, length, file) == length &&
+         fwrite(result->functions, sizeof(analysis_function_t), result->function_count, file) == result->function_count &&
+         fwrite(result->xrefs, sizeof(analysis_xref_t), result->xref_count, file) == result->xref_count;
+    ok = !fclose(file) && ok;
+    free(rle);
+    if (!ok) {
+        remove(path);
+    }
+    return ok;
+}
+
+static bool analysis_load_file(analysis_t *result, const char *path, uint64_t hash) {
+    os_file_map_t *map = os_file_map(path);
+    const analysis_header_t *header;
+    const uint8_t *data, *end;
+    uint32_t address = 0;
+    size_t size;
+
+    memset(result, 0, sizeof(*result));
+    if (!map) {
+        return false;
+    }
+    data = os_file_map_data(map);
+    size = os_file_map_size(map);
+    header = (const analysis_header_t *)data;
+    if (size < sizeof(*header) || memcmp(header->magic, analysis_magic, sizeof(header->magic)) ||
+        header->version != ANALYSIS_VERSION || header->size != ANALYSIS_SIZE || header->hash != hash ||
+        size != sizeof(*header) + header->flags_length + (size_t)header->function_count * sizeof(analysis_function_t) +
+                (size_t)header->xref_count * sizeof(analysis_xref_t)) {
+        goto fail;
+    }
+
+    result->hash = hash;
+    result->flags = malloc(ANALYSIS_SIZE);
+    result->function_count = header->function_count;
+    result->functions = malloc((size_t)header->function_count * sizeof(analysis_function_t) + 1);
+    result->xref_count = header->xref_count;
+    result->xrefs = malloc((size_t)header->xref_count * sizeof(analysis_xref_t) + 1);
+    if (!result->flags || !result->functions || !result->xrefs) {
+        goto fail;
+    }
+
+    data += sizeof(*header);
+    end = data + header->flags_length;
+    while (data < end) {
+        uint8_t value = *data++;
+        uint32_t run = 0;
+        int shift = 0;
+        do {
+            if (data == end || shift > 21) {
+                goto fail;
+            }
+            run |= (uint32_t)(*data & 0x7F) << shift;
+            shift += 7;
+        } while (*data++ & 0x80);
+        if (run > ANALYSIS_SIZE - address) {
+            goto fail;
+        }
+        memset(result->flags + address, value, run);
+        address += run;
+    }
+    if (address != ANALYSIS_SIZE) {
+        goto fail;
+    }
+    memcpy(result->functions, data, (size_t)header->function_count * sizeof(analysis_function_t));
+    data += (size_t)header->function_count * sizeof(analysis_function_t);
+    memcpy(result->xrefs, data, (size_t)header->xref_count * sizeof(analysis_xref_t));
+
+    os_file_unmap(map);
+    return true;
+
+fail:
+    os_file_unmap(map);
+    analysis_free_result(result);
+    return false;
+}
+
+/* Running in the background */
+static void analysis_worker(void *arg) {
+    analysis_job_t *job = arg;
+
+    job->result.hash = job->hash;
+    if (analysis_run(job)) {
+        if (!analysis_save(&job->result, job->path)) {
+            gui_console_printf("[CEmu] Couldn't save the ROM analysis to %s.\n", job->path);
+        }
+    } else {
+        analysis_free_result(&job->result);
+    }
+
+    analysis_store_flag(&job->done, 1);
+    if (analysis_gui_callback) {
+        analysis_gui_callback();
+    }
+}
+
+static void analysis_job_free(analysis_job_t *job) {
+    os_thread_join(job->thread);
+    analysis_free_result(&job->result);
+    free(job->rom);
+    free(job->path);
+    free(job);
+}
+
+static void analysis_cancel(void) {
+    if (analysis_job) {
+        analysis_store_flag(&analysis_job->stop, 1);
+        analysis_job_free(analysis_job);
+        analysis_job = NULL;
+    }
+}
+
+bool analysis_start(const char *dir) {
+    analysis_job_t *job;
+    uint64_t hash;
+    size_t length;
+
+    if (!mem.flash.block) {
+        return false;
+    }
+    hash = analysis_hash(mem.flash.block);
+    if ((analysis.flags && analysis.hash == hash) || (analysis_job && analysis_job->hash == hash)) {
+        return true;
+    }
+    analysis_cancel();
+
+    if (!(job = calloc(1, sizeof(analysis_job_t)))) {
+        return false;
+    }
+    length = strlen(dir) + 40;
+    job->hash = hash;
+    job->path = malloc(length);
+    job->rom = malloc(ANALYSIS_SIZE);
+    if (!job->path || !job->rom) {
+        free(job->path);
+        free(job->rom);
+        free(job);
+        return false;
+    }
+    snprintf(job->path, length, "%s/analysis-%016llX.bin", dir, (unsigned long long)hash);
+
+    if (analysis_load_file(&job->result, job->path, hash)) {
+        analysis_free_result(&analysis);
+        analysis = job->result;
+        free(job->rom);
+        free(job->path);
+        free(job);
+        return true;
+    }
+
+    memcpy(job->rom, mem.flash.block, ANALYSIS_SIZE);
+    if (!(job->thread = os_thread_start(analysis_worker, job))) {
+        free(job->rom);
+        free(job->path);
+        free(job);
+        return false;
+    }
+    analysis_job = job;
+    return true;
+}
+
+bool analysis_update(void) {
+    if (!analysis_job || !analysis_load_flag(&analysis_job->done)) {
+        return false;
+    }
+    os_thread_join(analysis_job->thread);
+    analysis_free_result(&analysis);
+    analysis = analysis_job->result;
+    free(analysis_job->rom);
+    free(analysis_job->path);
+    free(analysis_job);
+    analysis_job = NULL;
+    return analysis.flags != NULL;
+}
+
+void analysis_free(void) {
+    analysis_cancel();
+    analysis_free_result(&analysis);
+}
+
+/* Queries */
+uint8_t analysis_flags(uint32_t address) {
+    return analysis.flags && address < ANALYSIS_SIZE ? analysis.flags[address] : 0;
+}
+
+const analysis_function_t *analysis_function(uint32_t address) {
+    uint32_t low = 0, high = analysis.function_count;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (analysis.functions[mid].start <= address) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low && address < analysis.functions[low - 1].end) {
+        return &analysis.functions[low - 1];
+    }
+    return NULL;
+}
+
+uint32_t analysis_xrefs_to(uint32_t address, const analysis_xref_t **xrefs) {
+    uint32_t low = 0, high = analysis.xref_count, first;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (analysis.xrefs[mid].to < address) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    first = low;
+    while (low < analysis.xref_count && analysis.xrefs[low].to == address) {
+        low++;
+    }
+    *xrefs = analysis.xrefs + first;
+    return low - first;
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef ANALYSIS_H
+#define ANALYSIS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Static analysis of the boot code and OS, which sit in flash below the archive. Code is found by following
+ * control flow from the reset, RST and NMI vectors and from every jump table, so it doesn't have to have run
+ * first. Results are saved under the hash of those bytes and loaded straight back for the same ROM.
+ */
+#define ANALYSIS_SIZE 0xC0000
+
+/* What is known about each byte */
+#define ANALYSIS_CODE     (1 << 0)  /* Part of an instruction */
+#define ANALYSIS_START    (1 << 1)  /* First byte of an instruction */
+#define ANALYSIS_ADL      (1 << 2)  /* The instruction starting here runs in ADL mode */
+#define ANALYSIS_FUNCTION (1 << 3)  /* Called, a vector, or where a jump table entry goes */
+#define ANALYSIS_TARGET   (1 << 4)  /* Jumped to */
+#define ANALYSIS_DATA     (1 << 5)  /* Referenced as data and not reached as code */
+
+typedef struct {
+    uint32_t start;
+    uint32_t end;           /* Past the last instruction reached from start, and no further than the next function */
+} analysis_function_t;
+
+typedef enum {
+    ANALYSIS_XREF_CALL,
+    ANALYSIS_XREF_JUMP,
+    ANALYSIS_XREF_DATA
+} analysis_xref_kind_t;
+
+typedef struct {
+    uint32_t from;          /* Address of the referencing instruction */
+    uint32_t to;
+    uint32_t kind;
+} analysis_xref_t;
+
+typedef struct {
+    uint64_t hash;
+    uint8_t *flags;                     /* ANALYSIS_SIZE entries, NULL when nothing is loaded */
+    analysis_function_t *functions;     /* Sorted by start */
+    uint32_t function_count;
+    analysis_xref_t *xrefs;             /* Sorted by target, then by source */
+    uint32_t xref_count;
+} analysis_t;
+
+/* The results in use; only touched from the GUI thread, and only replaced by analysis_update() */
+extern analysis_t analysis;
+
+/*
+ * Look at the ROM as it is now; only while the emulation is stopped. Results saved in dir for the same ROM are
+ * loaded right away, otherwise the ROM is analysed in the background and saved there once done. Does nothing
+ * if those results are already loaded or being worked out.
+ */
+bool analysis_start(const char *dir);
+/* Take in finished background results; true if they changed */
+bool analysis_update(void);
+void analysis_free(void);
+
+/* Set this callback function pointer from the GUI. Called on the analysis thread once its results are ready */
+extern void (*analysis_gui_callback)(void);
+
+uint8_t analysis_flags(uint32_t address);
+/* The function the address is in, or NULL */
+const analysis_function_t *analysis_function(uint32_t address);
+/* References to an address; returns how many there are and where they start */
+uint32_t analysis_xrefs_to(uint32_t address, const analysis_xref_t **xrefs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,349 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+
+#include "coverage.h"
+#include "debug.h"
+#include "opcodes.h"
+#include "../os/os.h"
+
+#define COVERAGE_BITMAP    (0x1000000 / 8)
+#define COVERAGE_BYTES     8        /* Enough of a statement's bytes to decode an instruction */
+#define COVERAGE_LINE_SIZE 1024
+
+coverage_t coverage;
+
+static struct {
+    uint8_t *executed;              /* The three bitmaps are one allocation */
+    uint8_t *taken;
+    uint8_t *not_taken;
+} cov;
+
+/* Nothing gathered yet reads as nothing run */
+static inline bool coverage_bit(const uint8_t *bitmap, uint32_t address) {
+    return bitmap && bitmap[(address & 0xFFFFFF) >> 3] >> (address & 7) & 1;
+}
+
+void coverage_instruction(uint32_t pc) {
+    cov.executed[pc >> 3] |= 1 << (pc & 7);
+    coverage.pc = pc;
+}
+
+void coverage_branch(bool taken) {
+    uint8_t *bitmap = taken ? cov.taken : cov.not_taken;
+    bitmap[coverage.pc >> 3] |= 1 << (coverage.pc & 7);
+}
+
+bool coverage_start(void) {
+    if (!cov.executed) {
+        if (!(cov.executed = calloc(3, COVERAGE_BITMAP))) {
+            return false;
+        }
+        cov.taken = cov.executed + COVERAGE_BITMAP;
+        cov.not_taken = cov.taken + COVERAGE_BITMAP;
+    }
+    coverage.active = true;
+    debug_hook_set(DBG_HOOK_COVERAGE, true);
+    return true;
+}
+
+void coverage_stop(void) {
+    coverage.active = false;
+    debug_hook_set(DBG_HOOK_COVERAGE, false);
+}
+
+void coverage_clear(void) {
+    if (cov.executed) {
+        memset(cov.executed, 0, 3 * COVERAGE_BITMAP);
+    }
+}
+
+void coverage_free(void) {
+    coverage_stop();
+    free(cov.executed);
+    memset(&cov, 0, sizeof(cov));
+}
+
+uint32_t coverage_instructions(void) {
+    uint32_t count = 0, i;
+    if (cov.executed) {
+        for (i = 0; i < COVERAGE_BITMAP; i++) {
+            count += (uint32_t)__builtin_popcount(cov.executed[i]);
+        }
+    }
+    return count;
+}
+
+/* What a listing says about one source line that assembled to code */
+typedef struct {
+    uint32_t line;
+    bool executed;
+    bool branch;
+    bool taken, not_taken;
+} coverage_line_t;
+
+typedef struct {
+    char *name;
+    coverage_line_t *lines;
+    size_t count, capacity;
+} coverage_file_t;
+
+typedef struct {
+    coverage_file_t *files;
+    size_t count, capacity;
+} coverage_report_t;
+
+/* A statement being read: its first line, then any lines its bytes carry on to */
+typedef struct {
+    bool valid;
+    uint32_t line;
+    uint32_t address;
+    uint8_t bytes[COVERAGE_BYTES];
+    uint32_t size;
+    bool code;
+} coverage_statement_t;
+
+static coverage_file_t *coverage_file(coverage_report_t *report, const char *name) {
+    size_t i;
+    for (i = 0; i < report->count; i++) {
+        if (!strcmp(report->files[i].name, name)) {
+            return &report->files[i];
+        }
+    }
+    if (report->count == report->capacity) {
+        size_t capacity = report->capacity ? report->capacity * 2 : 8;
+        coverage_file_t *files = realloc(report->files, capacity * sizeof(coverage_file_t));
+        if (!files) {
+            return NULL;
+        }
+        report->files = files;
+        report->capacity = capacity;
+    }
+    if (!(report->files[report->count].name = strdup(name))) {
+        return NULL;
+    }
+    report->files[report->count].lines = NULL;
+    report->files[report->count].count = report->files[report->count].capacity = 0;
+    return &report->files[report->count++];
+}
+
+static uint8_t coverage_statement_read(void *context, uint32_t address) {
+    const coverage_statement_t *statement = context;
+    address -= statement->address;
+    return address < statement->size ? statement->bytes[address] : 0;
+}
+
+static bool coverage_add(coverage_file_t *file, const coverage_statement_t *statement) {
+    coverage_line_t *line;
+    opcode_inst_t inst;
+
+    if (!statement->valid || !statement->code || !statement->size) {
+        return true;
+    }
+    if (file->count == file->capacity) {
+        size_t capacity = file->capacity ? file->capacity * 2 : 256;
+        coverage_line_t *lines = realloc(file->lines, capacity * sizeof(coverage_line_t));
+        if (!lines) {
+            return false;
+        }
+        file->lines = lines;
+        file->capacity = capacity;
+    }
+    opcode_decode(&inst, statement->address, true, coverage_statement_read, (void *)statement);
+    line = &file->lines[file->count++];
+    line->line = statement->line;
+    line->executed = coverage_bit(cov.executed, statement->address);
+    line->branch = (inst.opcode->flags & (OPCODE_CONDITIONAL | OPCODE_REPEAT)) == OPCODE_CONDITIONAL;
+    line->taken = coverage_bit(cov.taken, statement->address);
+    line->not_taken = coverage_bit(cov.not_taken, statement->address);
+    return true;
+}
+
+static uint8_t coverage_hex(char c) {
+    return (uint8_t)(isdigit((unsigned char)c) ? c - '0' : (tolower((unsigned char)c) - 'a' + 10));
+}
+
+/* Reads the four byte columns of a listing line into the statement, and finds the source after them */
+static bool coverage_columns(const char *in, coverage_statement_t *statement, const char **source) {
+    int i;
+    for (i = 0; i < 4; i++, in += 3) {
+        if (isxdigit((unsigned char)in[0]) && isxdigit((unsigned char)in[1]) && in[2] == ' ') {
+            if (statement->size < COVERAGE_BYTES) {
+                statement->bytes[statement->size++] = (uint8_t)(coverage_hex(in[0]) << 4 | coverage_hex(in[1]));
+            }
+        } else if (in[0] != '-' || in[1] != ' ' || in[2] != ' ') {
+            return false;
+        }
+    }
+    *source = in;
+    return true;
+}
+
+/* Whether a source line is an instruction, rather than a directive, data, a label or a comment */
+static bool coverage_is_code(const char *source) {
+    const char *label;
+    while (isspace((unsigned char)*source)) {
+        source++;
+    }
+    for (label = source; isalnum((unsigned char)*label) || *label == '_' || *label == '.'; label++);
+    if (*label == ':' && label != source) {
+        for (source = label + 1; isspace((unsigned char)*source); source++);
+    }
+    return *source && *source != ';' && *source != '.' && *source != '#';
+}
+
+/*
+ * Listings as spasm writes them: a header naming the source file, then for each source line its number, the
+ * address as bank:offset, four columns of bytes and the source. Statements with more than four bytes carry on
+ * over lines with only byte columns, and the source comes on the last of them.
+ */
+static bool coverage_listing(coverage_report_t *report, const char *path) {
+    static const char header[] = "Listing for file \"";
+    char buffer[COVERAGE_LINE_SIZE];
+    char name[COVERAGE_LINE_SIZE];
+    coverage_statement_t statement = { 0 };
+    coverage_file_t *file = NULL;
+    const char *base = path, *p;
+    FILE *in;
+    bool ok = true;
+
+    for (p = path; *p; p++) {
+        if (*p == '/' || *p == '\\') {
+            base = p + 1;
+        }
+    }
+    if (!(in = fopen_utf8(path, "r"))) {
+        return false;
+    }
+
+    while (ok && fgets(buffer, sizeof(buffer), in)) {
+        const char *source;
+        unsigned int number, bank, offset;
+        int consumed;
+
+        /* Only the start of an overlong line is of any use */
+        if (!strchr(buffer, '\n')) {
+            int c;
+            while ((c = fgetc(in)) != EOF && c != '\n');
+        }
+
+        if (!strncmp(buffer, header, sizeof(header) - 1)) {
+            char *end = strchr(buffer + sizeof(header) - 1, '"');
+            const char *source_name = buffer + sizeof(header) - 1;
+            ok = coverage_add(file, &statement);
+            statement.valid = false;
+            if (end) {
+                *end = '\0';
+            }
+            /* Relative to where the listing is, which is where spasm ran */
+            if (source_name[0] == '/' || source_name[0] == '\\' || (source_name[0] && source_name[1] == ':')) {
+                snprintf(name, sizeof(name), "%s", source_name);
+            } else {
+                snprintf(name, sizeof(name), "%.*s%s", (int)(base - path), path, source_name);
+            }
+            ok = ok && (file = coverage_file(report, name));
+        } else if (file && sscanf(buffer, "%u %x:%x %n", &number, &bank, &offset, &consumed) == 3) {
+            ok = coverage_add(file, &statement);
+            statement.valid = true;
+            statement.line = number;
+            statement.address = (bank & 0xFF) << 16 | (offset & 0xFFFF);
+            statement.size = 0;
+            statement.code = false;
+            if (coverage_columns(buffer + consumed, &statement, &source)) {
+                statement.code = coverage_is_code(source);
+            } else {
+                statement.valid = false;
+            }
+        } else if (file && statement.valid && buffer[0] == ' ') {
+            for (p = buffer; *p == ' '; p++);
+            if (coverage_columns(p, &statement, &source)) {
+                statement.code = coverage_is_code(source);
+            }
+        }
+    }
+    ok = ok && !ferror(in);
+    if (ok && file) {
+        ok = coverage_add(file, &statement);
+    }
+    fclose(in);
+    return ok;
+}
+
+static int coverage_line_compare(const void *a, const void *b) {
+    uint32_t x = ((const coverage_line_t *)a)->line, y = ((const coverage_line_t *)b)->line;
+    return (x > y) - (x < y);
+}
+
+static void coverage_write_file(FILE *out, coverage_file_t *file) {
+    uint32_t lines = 0, lines_hit = 0, branches = 0, branches_hit = 0;
+    size_t i, j;
+
+    /* A line that assembled more than once, like in a macro, counts as run if any of it did */
+    qsort(file->lines, file->count, sizeof(coverage_line_t), coverage_line_compare);
+    for (i = j = 0; i < file->count; i++) {
+        if (j && file->lines[j - 1].line == file->lines[i].line) {
+            coverage_line_t *line = &file->lines[j - 1];
+            line->executed |= file->lines[i].executed;
+            line->branch |= file->lines[i].branch;
+            line->taken |= file->lines[i].taken;
+            line->not_taken |= file->lines[i].not_taken;
+        } else {
+            file->lines[j++] = file->lines[i];
+        }
+    }
+    file->count = j;
+
+    fprintf(out, "TN:\nSF:%s\n", file->name);
+    for (i = 0; i < file->count; i++) {
+        const coverage_line_t *line = &file->lines[i];
+        fprintf(out, "DA:%u,%d\n", line->line, line->executed);
+        lines++;
+        lines_hit += line->executed;
+    }
+    for (i = 0; i < file->count; i++) {
+        const coverage_line_t *line = &file->lines[i];
+        if (!line->branch) {
+            continue;
+        }
+        if (line->executed) {
+            fprintf(out, "BRDA:%u,0,0,%d\nBRDA:%u,0,1,%d\n", line->line, line->taken, line->line, line->not_taken);
+        } else {
+            fprintf(out, "BRDA:%u,0,0,-\nBRDA:%u,0,1,-\n", line->line, line->line);
+        }
+        branches += 2;
+        branches_hit += line->taken + line->not_taken;
+    }
+    fprintf(out, "BRF:%u\nBRH:%u\nLF:%u\nLH:%u\nend_of_record\n", branches, branches_hit, lines, lines_hit);
+}
+
+bool coverage_export_lcov(const char *path, const char *const *listings, unsigned int count) {
+    coverage_report_t report = { 0 };
+    FILE *out = NULL;
+    bool ok = true;
+    size_t i;
+
+    for (i = 0; ok && i < count; i++) {
+        ok = coverage_listing(&report, listings[i]);
+    }
+    if (ok && (out = fopen_utf8(path, "w"))) {
+        for (i = 0; i < report.count; i++) {
+            coverage_write_file(out, &report.files[i]);
+        }
+        ok = !ferror(out);
+        ok = !fclose(out) && ok;
+    } else {
+        ok = false;
+    }
+
+    for (i = 0; i < report.count; i++) {
+        free(report.files[i].name);
+        free(report.files[i].lines);
+    }
+    free(report.files);
+    return ok;
+}
+
+#endif
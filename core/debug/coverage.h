@@ -0,0 +1,46 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef COVERAGE_H
+#define COVERAGE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Which instructions ran, and which way each conditional jump, call or return went, as one bit per address for
+ * each. Runs add up until cleared, so a whole test suite can be gathered into one report. The report maps the
+ * bits back to source lines through spasm listings (-L), in the lcov tracefile format.
+ */
+typedef struct {
+    bool active;
+    uint32_t pc;                /* Start of the instruction running now */
+} coverage_t;
+
+extern coverage_t coverage;
+
+/* Carries on from what was gathered before unless it was cleared; false without the memory for the bitmaps */
+bool coverage_start(void);
+void coverage_stop(void);
+/* Forget what was gathered */
+void coverage_clear(void);
+void coverage_free(void);
+/* Different instructions seen to run */
+uint32_t coverage_instructions(void);
+/* Write an lcov report of the lines in the listings; false if a listing couldn't be read or the report written */
+bool coverage_export_lcov(const char *path, const char *const *listings, unsigned int count);
+
+/* Hooks */
+void coverage_instruction(uint32_t pc);     /* Before each instruction */
+void coverage_branch(bool taken);           /* When a condition decides whether the instruction jumps */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
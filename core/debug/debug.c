@@ -1,15 +1,19 @@
 #ifdef DEBUG_SUPPORT
 
 #include <stdio.h>
+#include <string.h>
 
 #include "disasm.h"
 #include "debug.h"
+#include "trace.h"
 #include "../mem.h"
 #include "../emu.h"
 #include "../asic.h"
+#include "../perf.h"
 
 volatile bool inDebugger = false;
 debug_state_t debugger;
+uint8_t debug_hooks;
 
 void debugger_init(void) {
     debugger.stepOverInstrEnd = -1;
@@ -80,12 +84,73 @@ void debug_write_byte(uint32_t address, uint8_t value) {
     if (address < 0xE00000) {
         if ((ptr = phys_mem_ptr(address, 1))) {
             *ptr = value;
+            disasm_cache_write(address);
+            if (address >= 0xD00000) {
+                lcd_mark_dirty(address - 0xD00000, 1);
+            }
         }
     } else {
         debug_port_write_byte(mmio_range(address)<<12 | addr_range(address), value);
     }
 }
 
+/* Whole ranges at a time, and without marking anything for the disassembly view */
+void debug_read_block(uint32_t address, uint32_t size, uint8_t *out) {
+    while (size) {
+        uint32_t run = size;
+        uint8_t *ptr;
+
+        address &= 0xFFFFFF;
+        if (address >= 0xE00000) {
+            *out++ = debug_port_read_byte(mmio_range(address)<<12 | addr_range(address));
+            address++;
+            size--;
+            continue;
+        }
+
+        if ((ptr = phys_mem_span(address, &run))) {
+            memcpy(out, ptr, run);
+        } else {
+            memset(out, 0, run);
+        }
+        out += run;
+        address += run;
+        size -= run;
+    }
+}
+
+void debug_write_block(uint32_t address, uint32_t size, const uint8_t *in) {
+    while (size) {
+        uint32_t run = size;
+        uint8_t *ptr;
+
+        address &= 0xFFFFFF;
+        if (address >= 0xE00000) {
+            debug_port_write_byte(mmio_range(address)<<12 | addr_range(address), *in++);
+            address++;
+            size--;
+            continue;
+        }
+
+        if ((ptr = phys_mem_span(address, &run))) {
+            memcpy(ptr, in, run);
+            if (address >= 0xD00000) {
+                uint32_t page;
+                /* Only the RAM pages written to are disassembled again */
+                for (page = address & ~0xFFu; page < address + run; page += 0x100) {
+                    disasm_cache_write(page);
+                }
+                lcd_mark_dirty(address - 0xD00000, run);
+            } else {
+                disasm_cache_flush();
+            }
+        }
+        in += run;
+        address += run;
+        size -= run;
+    }
+}
+
 uint8_t debug_port_read_byte(uint32_t address) {
     return apb_map[port_range(address)].range->read_in(addr_range(address));
 }
@@ -96,6 +161,7 @@ void debug_port_write_byte(uint32_t address, uint8_t value) {
 /* okay, so looking at the data inside the asic should be okay when using this function, */
 /* since it is called outside of cpu_execute(). Which means no read/write errors. */
 void open_debugger(int reason, uint32_t data) {
+    uint32_t host;
     if (inDebugger) {
         return; // don't recurse
     }
@@ -113,14 +179,20 @@ void open_debugger(int reason, uint32_t data) {
         debug_clear_step_over();
     }
 
+    if (trace.active && reason >= HIT_EXEC_BREAKPOINT && reason <= HIT_PORT_READ_BREAKPOINT) {
+        trace_event(TRACE_SAVE_BREAKPOINT);
+    }
+
     debugger.cpu_cycles = cpu.cycles;
     debugger.cpu_next = cpu.next;
+    host = perf_host_switch(PERF_HOST_DEBUGGER);
     gui_debugger_raise_or_disable(inDebugger = true);
     gui_debugger_send_command(reason, data);
 
     do {
         gui_emu_sleep();
     } while(inDebugger);
+    perf_host_switch(host);
 
     if (debugger.stepOverRequested) {
         debug_clear_step_over();
@@ -203,6 +275,14 @@ void debug_breakpoint_remove(uint32_t address) {
     debug_breakpoint_set(address, ~DBG_NO_HANDLE, false);
 }
 
+void debug_hook_set(unsigned int hook, bool set) {
+    if (set) {
+        debug_hooks |= hook;
+    } else {
+        debug_hooks &= ~hook;
+    }
+}
+
 void debug_pmonitor_set(uint16_t address, unsigned int type, bool set) {
     if (set) {
         debugger.data.ports[address] |= type;
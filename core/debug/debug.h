@@ -42,6 +42,12 @@ enum {
 #define DBG_INST_START_MARKER     (1 << 5)
 #define DBG_INST_MARKER           (1 << 6)
 
+/* Tools that look at every instruction, as bits of debug_hooks */
+#define DBG_HOOK_PROFILER         (1 << 0)
+#define DBG_HOOK_TRACE            (1 << 1)
+#define DBG_HOOK_COVERAGE         (1 << 2)
+#define DBG_HOOK_IOTRACE          (1 << 3)
+
 #define DBG_PORT_RANGE            0xFFFF00
 #define DBGOUT_PORT_RANGE         0xFB0000
 #define DBGERR_PORT_RANGE         0xFC0000
@@ -75,6 +81,14 @@ typedef struct {        /* For debugging */
 /* Debugging */
 extern debug_state_t debugger;
 
+/*
+ * The profiler, trace, coverage, I/O trace and timeline keep what the emulation reads as it runs in a global of
+ * their own; everything else they have is only called while the emulation is stopped. Stopping one keeps what it
+ * recorded for export until it is started over or freed. Each one that looks at every instruction has a bit in
+ * debug_hooks, so the CPU tests one thing when none do.
+ */
+extern uint8_t debug_hooks;
+
 void debugger_init(void);
 void debugger_free(void);
 
@@ -83,6 +97,8 @@ uint16_t debug_read_short(uint32_t address);
 uint32_t debug_read_long(uint32_t address);
 uint32_t debug_read_word(uint32_t address, bool mode);
 void debug_write_byte(uint32_t address, uint8_t value);
+void debug_read_block(uint32_t address, uint32_t size, uint8_t *out);
+void debug_write_block(uint32_t address, uint32_t size, const uint8_t *in);
 uint8_t debug_port_read_byte(uint32_t address);
 void debug_port_write_byte(uint32_t address, uint8_t value);
 void open_debugger(int reason, uint32_t address);
@@ -93,6 +109,8 @@ void debug_toggle_run_until(uint32_t address);
 void debug_breakpoint_set(uint32_t address, unsigned int type, bool set);
 void debug_breakpoint_remove(uint32_t address);
 
+void debug_hook_set(unsigned int hook, bool set);
+
 void debug_pmonitor_set(uint16_t address, unsigned int type, bool set);
 void debug_pmonitor_remove(uint16_t address);
 
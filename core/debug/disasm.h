@@ -21,21 +21,28 @@ typedef struct {
 
 extern disasm_highlights_state_t disasmHighlight;
 
+/* Drop cached disassembly of memory that changed; flushing drops all of it, e.g. when labels change */
+void disasm_cache_write(uint32_t address);
+void disasm_cache_flush(void);
+
 #ifdef __cplusplus
 }
 
 #include <string>
-#include <unordered_map>
 #include <stdint.h>
 
-typedef std::unordered_map<uint32_t, std::string> addressMap_t;
+#define DISASM_MAX_DATA       16    /* Bytes shown in the data column */
+#define DISASM_ARGUMENTS_SIZE 128
+#define DISASM_SYMBOL_RANGE   0xFF  /* Furthest a long operand is shown past a symbol, as symbol+offset */
 
 typedef struct {
-    std::string opcode;
-    std::string arguments;
-    std::string mode_suffix;
-    std::string data;
+    const char *opcode;
+    const char *mode_suffix;
+    char arguments[DISASM_ARGUMENTS_SIZE];
+    char data[DISASM_MAX_DATA * 2 + 1];
     unsigned int size;
+    unsigned int cycles;        /* Where it is, with memory timed as it is now; 0 for data and traps */
+    unsigned int cycles_taken;  /* Jumping, or each further round of a block instruction; 0 if it can't */
 } eZ80_instuction_t;
 
 typedef struct {
@@ -44,7 +51,6 @@ typedef struct {
     int32_t new_address;
     uint8_t prefix, suffix;
     bool adl, iw, il, l;
-    addressMap_t addressMap;
 } disasm_state_t;
 
 extern disasm_state_t disasm;
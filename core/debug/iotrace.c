@@ -0,0 +1,138 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "iotrace.h"
+#include "debug.h"
+#include "../perf.h"
+#include "../schedule.h"
+#include "../os/os.h"
+
+iotrace_t iotrace;
+
+static struct {
+    iotrace_record_t *records;
+    uint32_t capacity;
+    uint32_t head;                          /* Written next */
+    uint64_t total;
+} io;
+
+void iotrace_access(uint16_t port, uint8_t value, bool write) {
+    iotrace_record_t *record = &io.records[io.head];
+    record->cycle = sched_total_cycles();
+    record->pc = iotrace.pc;
+    record->port = port;
+    record->value = value;
+    record->flags = write ? IOTRACE_WRITE : 0;
+    if (++io.head == io.capacity) {
+        io.head = 0;
+    }
+    io.total++;
+}
+
+bool iotrace_start(uint32_t count, uint16_t reads, uint16_t writes) {
+    iotrace_stop();
+    free(io.records);
+    memset(&io, 0, sizeof(io));
+    if (!count || !(io.records = malloc((size_t)count * sizeof(iotrace_record_t)))) {
+        return false;
+    }
+    io.capacity = count;
+    iotrace.recording = true;
+    iotrace_filter(reads, writes);
+    return true;
+}
+
+void iotrace_filter(uint16_t reads, uint16_t writes) {
+    if (iotrace.recording) {
+        iotrace.reads = reads;
+        iotrace.writes = writes;
+        debug_hook_set(DBG_HOOK_IOTRACE, reads | writes);
+    }
+}
+
+void iotrace_stop(void) {
+    iotrace.recording = false;
+    iotrace.reads = iotrace.writes = 0;
+    debug_hook_set(DBG_HOOK_IOTRACE, false);
+}
+
+void iotrace_free(void) {
+    iotrace_stop();
+    free(io.records);
+    memset(&io, 0, sizeof(io));
+}
+
+uint32_t iotrace_count(void) {
+    return io.total < io.capacity ? (uint32_t)io.total : io.capacity;
+}
+
+uint64_t iotrace_total(void) {
+    return io.total;
+}
+
+const iotrace_record_t *iotrace_get(uint32_t index) {
+    uint32_t count = iotrace_count();
+    if (index >= count) {
+        return NULL;
+    }
+    index += io.head + io.capacity - count;
+    return &io.records[index % io.capacity];
+}
+
+bool iotrace_export_csv(const char *path) {
+    uint32_t count = iotrace_count(), i;
+    FILE *file;
+    bool ok;
+
+    if (!(file = fopen_utf8(path, "w"))) {
+        return false;
+    }
+    fputs("cycle,pc,access,port,range,value\n", file);
+    for (i = 0; i < count; i++) {
+        const iotrace_record_t *record = iotrace_get(i);
+        fprintf(file, "%llu,%06X,%s,%04X,%s,%02X\n", (unsigned long long)record->cycle, record->pc,
+                record->flags & IOTRACE_WRITE ? "write" : "read", record->port,
+                perf_range_names[record->port >> 12 & (IOTRACE_RANGES - 1)], record->value);
+    }
+    ok = !ferror(file);
+    ok = !fclose(file) && ok;
+    return ok;
+}
+
+static uint8_t *iotrace_put(uint8_t *out, uint64_t value, unsigned int size) {
+    while (size--) {
+        *out++ = (uint8_t)value;
+        value >>= 8;
+    }
+    return out;
+}
+
+bool iotrace_export_binary(const char *path) {
+    uint32_t count = iotrace_count(), i;
+    uint8_t bytes[16];
+    FILE *file;
+    bool ok;
+
+    if (!(file = fopen_utf8(path, "wb"))) {
+        return false;
+    }
+    fwrite(IOTRACE_MAGIC, 1, IOTRACE_MAGIC_SIZE, file);
+    fwrite(bytes, 1, iotrace_put(bytes, count, 4) - bytes, file);
+    for (i = 0; i < count; i++) {
+        const iotrace_record_t *record = iotrace_get(i);
+        uint8_t *out = iotrace_put(bytes, record->cycle, 8);
+        out = iotrace_put(out, record->pc, 4);
+        out = iotrace_put(out, record->port, 2);
+        *out++ = record->value;
+        *out++ = record->flags;
+        fwrite(bytes, 1, out - bytes, file);
+    }
+    ok = !ferror(file);
+    ok = !fclose(file) && ok;
+    return ok;
+}
+
+#endif
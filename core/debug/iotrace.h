@@ -0,0 +1,72 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef IOTRACE_H
+#define IOTRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Every read and write of a port, whether by in and out or through its memory mapping, kept in a ring buffer
+ * without stopping the emulation. Each of the sixteen port ranges can be traced for reads, writes or both.
+ *
+ * A binary export is, little endian throughout:
+ *   IOTRACE_MAGIC
+ *   u32 record count, then for each record from the oldest: u64 cycle, u32 PC of the instruction, u16 port,
+ *       u8 value, u8 IOTRACE_WRITE if it was a write
+ * The range of a port is its top four bits.
+ */
+
+#define IOTRACE_MAGIC      "CEmuIOT1"
+#define IOTRACE_MAGIC_SIZE 8
+#define IOTRACE_RANGES     0x10
+#define IOTRACE_ALL        0xFFFF
+#define IOTRACE_WRITE      (1 << 0)
+
+typedef struct {
+    uint64_t cycle;
+    uint32_t pc;
+    uint16_t port;
+    uint8_t value;
+    uint8_t flags;
+} iotrace_record_t;
+
+typedef struct {
+    uint16_t reads;             /* A bit for each range to trace */
+    uint16_t writes;
+    uint32_t pc;                /* Start of the instruction running now, while tracing */
+    bool recording;             /* Started and not stopped, even if every range is filtered out for now */
+} iotrace_t;
+
+/* The ports look at reads and writes on every access */
+extern iotrace_t iotrace;
+
+/* Starts with room for count records, the oldest overwritten once it's full; false without the memory */
+bool iotrace_start(uint32_t count, uint16_t reads, uint16_t writes);
+/* Change which ranges are traced from now on, keeping what was traced so far */
+void iotrace_filter(uint16_t reads, uint16_t writes);
+void iotrace_stop(void);
+void iotrace_free(void);
+/* Records held now, and all traced since the start, including the ones that were overwritten */
+uint32_t iotrace_count(void);
+uint64_t iotrace_total(void);
+/* The index-th record held, from the oldest */
+const iotrace_record_t *iotrace_get(uint32_t index);
+/* Write the records held as CSV or in the binary format; false if they couldn't be written */
+bool iotrace_export_csv(const char *path);
+bool iotrace_export_binary(const char *path);
+
+/* Hook */
+void iotrace_access(uint16_t port, uint8_t value, bool write);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,1501 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "opcodes.h"
+#include "../cpu.h"
+#include "../mem.h"
+
+/*
+ * Costs are what the CPU emulation adds up for each instruction, with memory accesses counted separately.
+ * Traps are left at nothing.
+ */
+const opcode_t opcode_main[256] = {
+    /* 00 */ { "nop",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 01 */ { "ld",          "bc,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 02 */ { "ld",          "(bc),a",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 03 */ { "inc",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 04 */ { "inc",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 05 */ { "dec",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 06 */ { "ld",          "b,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 07 */ { "rlca",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 08 */ { "ex",          "af,af'",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 09 */ { "add",         "hl,bc",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0A */ { "ld",          "a,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 0B */ { "dec",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0C */ { "inc",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0D */ { "dec",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0E */ { "ld",          "c,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0F */ { "rrca",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 10 */ { "djnz",        "%w",        OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 11 */ { "ld",          "de,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 12 */ { "ld",          "(de),a",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 13 */ { "inc",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 14 */ { "inc",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 15 */ { "dec",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 16 */ { "ld",          "d,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 17 */ { "rla",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 18 */ { "jr",          "%w",        OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     0,                  { 0, 1, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0, 0 } },
+    /* 19 */ { "add",         "hl,de",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1A */ { "ld",          "a,(de)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 1B */ { "dec",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1C */ { "inc",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1D */ { "dec",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1E */ { "ld",          "e,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1F */ { "rra",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 20 */ { "jr",          "nz,%w",     OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 21 */ { "ld",          "hl,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 22 */ { "ld",          "(%w),hl",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 23 */ { "inc",         "hl",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 24 */ { "inc",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 25 */ { "dec",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 26 */ { "ld",          "h,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 27 */ { "daa",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 28 */ { "jr",          "z,%w",      OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 29 */ { "add",         "hl,hl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2A */ { "ld",          "hl,(%w)",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 2B */ { "dec",         "hl",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2C */ { "inc",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2D */ { "dec",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2E */ { "ld",          "l,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2F */ { "cpl",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 30 */ { "jr",          "nc,%w",     OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 31 */ { "ld",          "sp,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 32 */ { "ld",          "(%w),a",    OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 33 */ { "inc",         "sp",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 34 */ { "inc",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 35 */ { "dec",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 36 */ { "ld",          "(hl),%n",   OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 37 */ { "scf",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 38 */ { "jr",          "c,%w",      OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 39 */ { "add",         "hl,sp",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3A */ { "ld",          "a,(%w)",    OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 3B */ { "dec",         "sp",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3C */ { "inc",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3D */ { "dec",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3E */ { "ld",          "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3F */ { "ccf",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 40 */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 41 */ { "ld",          "b,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 42 */ { "ld",          "b,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 43 */ { "ld",          "b,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 44 */ { "ld",          "b,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 45 */ { "ld",          "b,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 46 */ { "ld",          "b,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 47 */ { "ld",          "b,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 48 */ { "ld",          "c,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 49 */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4A */ { "ld",          "c,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4B */ { "ld",          "c,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4C */ { "ld",          "c,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4D */ { "ld",          "c,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4E */ { "ld",          "c,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 4F */ { "ld",          "c,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 50 */ { "ld",          "d,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 51 */ { "ld",          "d,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 52 */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 53 */ { "ld",          "d,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 54 */ { "ld",          "d,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 55 */ { "ld",          "d,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 56 */ { "ld",          "d,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 57 */ { "ld",          "d,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 58 */ { "ld",          "e,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 59 */ { "ld",          "e,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5A */ { "ld",          "e,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5B */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5C */ { "ld",          "e,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5D */ { "ld",          "e,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5E */ { "ld",          "e,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 5F */ { "ld",          "e,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 60 */ { "ld",          "h,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 61 */ { "ld",          "h,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 62 */ { "ld",          "h,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 63 */ { "ld",          "h,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 64 */ { "ld",          "h,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 65 */ { "ld",          "h,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 66 */ { "ld",          "h,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 67 */ { "ld",          "h,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 68 */ { "ld",          "l,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 69 */ { "ld",          "l,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6A */ { "ld",          "l,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6B */ { "ld",          "l,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6C */ { "ld",          "l,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6D */ { "ld",          "l,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6E */ { "ld",          "l,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 6F */ { "ld",          "l,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 70 */ { "ld",          "(hl),b",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 71 */ { "ld",          "(hl),c",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 72 */ { "ld",          "(hl),d",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 73 */ { "ld",          "(hl),e",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 74 */ { "ld",          "(hl),h",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 75 */ { "ld",          "(hl),l",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 76 */ { "halt",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 77 */ { "ld",          "(hl),a",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 78 */ { "ld",          "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 79 */ { "ld",          "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7A */ { "ld",          "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7B */ { "ld",          "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7C */ { "ld",          "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7D */ { "ld",          "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7E */ { "ld",          "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 7F */ { "ld",          "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 80 */ { "add",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 81 */ { "add",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 82 */ { "add",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 83 */ { "add",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 84 */ { "add",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 85 */ { "add",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 86 */ { "add",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 87 */ { "add",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 88 */ { "adc",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 89 */ { "adc",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8A */ { "adc",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8B */ { "adc",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8C */ { "adc",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8D */ { "adc",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8E */ { "adc",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 8F */ { "adc",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 90 */ { "sub",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 91 */ { "sub",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 92 */ { "sub",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 93 */ { "sub",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 94 */ { "sub",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 95 */ { "sub",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 96 */ { "sub",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 97 */ { "sub",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 98 */ { "sbc",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 99 */ { "sbc",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9A */ { "sbc",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9B */ { "sbc",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9C */ { "sbc",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9D */ { "sbc",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9E */ { "sbc",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 9F */ { "sbc",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A0 */ { "and",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A1 */ { "and",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A2 */ { "and",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A3 */ { "and",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A4 */ { "and",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A5 */ { "and",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A6 */ { "and",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* A7 */ { "and",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A8 */ { "xor",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A9 */ { "xor",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AA */ { "xor",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AB */ { "xor",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AC */ { "xor",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AD */ { "xor",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AE */ { "xor",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* AF */ { "xor",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B0 */ { "or",          "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B1 */ { "or",          "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B2 */ { "or",          "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B3 */ { "or",          "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B4 */ { "or",          "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B5 */ { "or",          "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B6 */ { "or",          "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* B7 */ { "or",          "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B8 */ { "cp",          "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B9 */ { "cp",          "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BA */ { "cp",          "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BB */ { "cp",          "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BC */ { "cp",          "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BD */ { "cp",          "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BE */ { "cp",          "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* BF */ { "cp",          "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C0 */ { "ret",         "nz",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* C1 */ { "pop",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* C2 */ { "jp",          "nz,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* C3 */ { "jp",          "%w",        OPCODE_WORD,        OPCODE_FLOW_JUMP,     0,                  { 1, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* C4 */ { "call",        "nz,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* C5 */ { "push",        "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* C6 */ { "add",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* C8 */ { "ret",         "z",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* C9 */ { "ret",         "",          OPCODE_NONE,        OPCODE_FLOW_RETURN,   0,                  { 1, 1, 0, 1, 0, 0 }, { 1, 1, 0, 1, 0, 0 } },
+    /* CA */ { "jp",          "z,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* CB */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CC */ { "call",        "z,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* CD */ { "call",        "%w",        OPCODE_WORD,        OPCODE_FLOW_CALL,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* CE */ { "adc",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* D0 */ { "ret",         "nc",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* D1 */ { "pop",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* D2 */ { "jp",          "nc,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* D3 */ { "out",         "(%n),a",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* D4 */ { "call",        "nc,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* D5 */ { "push",        "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* D6 */ { "sub",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* D8 */ { "ret",         "c",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* D9 */ { "exx",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DA */ { "jp",          "c,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* DB */ { "in",          "a,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* DC */ { "call",        "c,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* DD */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DE */ { "sbc",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* E0 */ { "ret",         "po",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* E1 */ { "pop",         "hl",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* E2 */ { "jp",          "po,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* E3 */ { "ex",          "(sp),hl",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 1 }, { 0, 0, 0, 1, 0, 1 } },
+    /* E4 */ { "call",        "po,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* E5 */ { "push",        "hl",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* E6 */ { "and",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* E8 */ { "ret",         "pe",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* E9 */ { "jp",          "(hl)",      OPCODE_NONE,        OPCODE_FLOW_INDIRECT, 0,                  { 0, 2, 0, 0, 0, 0 }, { 0, 2, 0, 0, 0, 0 } },
+    /* EA */ { "jp",          "pe,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* EB */ { "ex",          "de,hl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EC */ { "call",        "pe,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* ED */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EE */ { "xor",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* F0 */ { "ret",         "p",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* F1 */ { "pop",         "af",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* F2 */ { "jp",          "p,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* F3 */ { "di",          "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F4 */ { "call",        "p,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* F5 */ { "push",        "af",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* F6 */ { "or",          "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* F8 */ { "ret",         "m",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* F9 */ { "ld",          "sp,hl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FA */ { "jp",          "m,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* FB */ { "ei",          "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FC */ { "call",        "m,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* FD */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FE */ { "cp",          "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+};
+
+const opcode_t opcode_cb[256] = {
+    /* 00 */ { "rlc",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 01 */ { "rlc",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 02 */ { "rlc",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 03 */ { "rlc",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 04 */ { "rlc",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 05 */ { "rlc",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 06 */ { "rlc",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 07 */ { "rlc",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 08 */ { "rrc",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 09 */ { "rrc",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0A */ { "rrc",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0B */ { "rrc",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0C */ { "rrc",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0D */ { "rrc",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0E */ { "rrc",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 0F */ { "rrc",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 10 */ { "rl",          "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 11 */ { "rl",          "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 12 */ { "rl",          "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 13 */ { "rl",          "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 14 */ { "rl",          "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 15 */ { "rl",          "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 16 */ { "rl",          "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 17 */ { "rl",          "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 18 */ { "rr",          "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 19 */ { "rr",          "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1A */ { "rr",          "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1B */ { "rr",          "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1C */ { "rr",          "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1D */ { "rr",          "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1E */ { "rr",          "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 1F */ { "rr",          "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 20 */ { "sla",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 21 */ { "sla",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 22 */ { "sla",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 23 */ { "sla",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 24 */ { "sla",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 25 */ { "sla",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 26 */ { "sla",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 27 */ { "sla",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 28 */ { "sra",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 29 */ { "sra",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2A */ { "sra",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2B */ { "sra",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2C */ { "sra",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2D */ { "sra",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2E */ { "sra",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 2F */ { "sra",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 30 */ { "OPCODETRAP",  "b",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 31 */ { "OPCODETRAP",  "c",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 32 */ { "OPCODETRAP",  "d",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 33 */ { "OPCODETRAP",  "e",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 34 */ { "OPCODETRAP",  "h",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 35 */ { "OPCODETRAP",  "l",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 36 */ { "OPCODETRAP",  "(hl)",      OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 37 */ { "OPCODETRAP",  "a",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 38 */ { "srl",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 39 */ { "srl",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3A */ { "srl",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3B */ { "srl",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3C */ { "srl",         "h",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3D */ { "srl",         "l",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3E */ { "srl",         "(hl)",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 3F */ { "srl",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 40 */ { "bit",         "0,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 41 */ { "bit",         "0,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 42 */ { "bit",         "0,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 43 */ { "bit",         "0,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 44 */ { "bit",         "0,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 45 */ { "bit",         "0,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 46 */ { "bit",         "0,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 47 */ { "bit",         "0,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 48 */ { "bit",         "1,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 49 */ { "bit",         "1,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4A */ { "bit",         "1,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4B */ { "bit",         "1,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4C */ { "bit",         "1,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4D */ { "bit",         "1,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4E */ { "bit",         "1,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 4F */ { "bit",         "1,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 50 */ { "bit",         "2,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 51 */ { "bit",         "2,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 52 */ { "bit",         "2,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 53 */ { "bit",         "2,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 54 */ { "bit",         "2,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 55 */ { "bit",         "2,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 56 */ { "bit",         "2,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 57 */ { "bit",         "2,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 58 */ { "bit",         "3,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 59 */ { "bit",         "3,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5A */ { "bit",         "3,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5B */ { "bit",         "3,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5C */ { "bit",         "3,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5D */ { "bit",         "3,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5E */ { "bit",         "3,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 5F */ { "bit",         "3,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 60 */ { "bit",         "4,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 61 */ { "bit",         "4,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 62 */ { "bit",         "4,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 63 */ { "bit",         "4,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 64 */ { "bit",         "4,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 65 */ { "bit",         "4,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 66 */ { "bit",         "4,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 67 */ { "bit",         "4,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 68 */ { "bit",         "5,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 69 */ { "bit",         "5,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6A */ { "bit",         "5,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6B */ { "bit",         "5,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6C */ { "bit",         "5,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6D */ { "bit",         "5,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6E */ { "bit",         "5,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 6F */ { "bit",         "5,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 70 */ { "bit",         "6,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 71 */ { "bit",         "6,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 72 */ { "bit",         "6,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 73 */ { "bit",         "6,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 74 */ { "bit",         "6,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 75 */ { "bit",         "6,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 76 */ { "bit",         "6,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 77 */ { "bit",         "6,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 78 */ { "bit",         "7,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 79 */ { "bit",         "7,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7A */ { "bit",         "7,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7B */ { "bit",         "7,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7C */ { "bit",         "7,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7D */ { "bit",         "7,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7E */ { "bit",         "7,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 7F */ { "bit",         "7,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 80 */ { "res",         "0,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 81 */ { "res",         "0,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 82 */ { "res",         "0,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 83 */ { "res",         "0,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 84 */ { "res",         "0,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 85 */ { "res",         "0,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 86 */ { "res",         "0,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 87 */ { "res",         "0,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 88 */ { "res",         "1,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 89 */ { "res",         "1,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8A */ { "res",         "1,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8B */ { "res",         "1,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8C */ { "res",         "1,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8D */ { "res",         "1,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8E */ { "res",         "1,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 8F */ { "res",         "1,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 90 */ { "res",         "2,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 91 */ { "res",         "2,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 92 */ { "res",         "2,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 93 */ { "res",         "2,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 94 */ { "res",         "2,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 95 */ { "res",         "2,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 96 */ { "res",         "2,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 97 */ { "res",         "2,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 98 */ { "res",         "3,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 99 */ { "res",         "3,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9A */ { "res",         "3,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9B */ { "res",         "3,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9C */ { "res",         "3,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9D */ { "res",         "3,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9E */ { "res",         "3,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 9F */ { "res",         "3,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A0 */ { "res",         "4,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A1 */ { "res",         "4,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A2 */ { "res",         "4,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A3 */ { "res",         "4,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A4 */ { "res",         "4,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A5 */ { "res",         "4,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A6 */ { "res",         "4,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* A7 */ { "res",         "4,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A8 */ { "res",         "5,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A9 */ { "res",         "5,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AA */ { "res",         "5,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AB */ { "res",         "5,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AC */ { "res",         "5,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AD */ { "res",         "5,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AE */ { "res",         "5,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* AF */ { "res",         "5,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B0 */ { "res",         "6,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B1 */ { "res",         "6,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B2 */ { "res",         "6,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B3 */ { "res",         "6,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B4 */ { "res",         "6,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B5 */ { "res",         "6,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B6 */ { "res",         "6,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* B7 */ { "res",         "6,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B8 */ { "res",         "7,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B9 */ { "res",         "7,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BA */ { "res",         "7,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BB */ { "res",         "7,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BC */ { "res",         "7,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BD */ { "res",         "7,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BE */ { "res",         "7,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* BF */ { "res",         "7,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C0 */ { "set",         "0,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C1 */ { "set",         "0,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C2 */ { "set",         "0,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C3 */ { "set",         "0,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C4 */ { "set",         "0,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C5 */ { "set",         "0,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C6 */ { "set",         "0,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* C7 */ { "set",         "0,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C8 */ { "set",         "1,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C9 */ { "set",         "1,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CA */ { "set",         "1,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CB */ { "set",         "1,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CC */ { "set",         "1,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CD */ { "set",         "1,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CE */ { "set",         "1,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* CF */ { "set",         "1,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D0 */ { "set",         "2,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D1 */ { "set",         "2,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D2 */ { "set",         "2,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D3 */ { "set",         "2,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D4 */ { "set",         "2,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D5 */ { "set",         "2,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D6 */ { "set",         "2,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* D7 */ { "set",         "2,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D8 */ { "set",         "3,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D9 */ { "set",         "3,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DA */ { "set",         "3,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DB */ { "set",         "3,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DC */ { "set",         "3,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DD */ { "set",         "3,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DE */ { "set",         "3,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* DF */ { "set",         "3,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E0 */ { "set",         "4,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E1 */ { "set",         "4,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E2 */ { "set",         "4,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E3 */ { "set",         "4,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E4 */ { "set",         "4,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E5 */ { "set",         "4,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E6 */ { "set",         "4,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* E7 */ { "set",         "4,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E8 */ { "set",         "5,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E9 */ { "set",         "5,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EA */ { "set",         "5,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EB */ { "set",         "5,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EC */ { "set",         "5,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* ED */ { "set",         "5,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EE */ { "set",         "5,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* EF */ { "set",         "5,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F0 */ { "set",         "6,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F1 */ { "set",         "6,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F2 */ { "set",         "6,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F3 */ { "set",         "6,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F4 */ { "set",         "6,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F5 */ { "set",         "6,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F6 */ { "set",         "6,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* F7 */ { "set",         "6,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F8 */ { "set",         "7,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F9 */ { "set",         "7,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FA */ { "set",         "7,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FB */ { "set",         "7,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FC */ { "set",         "7,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FD */ { "set",         "7,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FE */ { "set",         "7,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* FF */ { "set",         "7,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+};
+
+const opcode_t opcode_ed[256] = {
+    /* 00 */ { "in0",         "b,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 01 */ { "out0",        "(%n),b",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 02 */ { "lea",         "bc,ix%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 03 */ { "lea",         "bc,iy%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 04 */ { "tst",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 05 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 06 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 07 */ { "ld",          "bc,(hl)",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 08 */ { "in0",         "c,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 09 */ { "out0",        "(%n),c",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 0A */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0B */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0C */ { "tst",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0E */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0F */ { "ld",          "(hl),bc",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 10 */ { "in0",         "d,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 11 */ { "out0",        "(%n),d",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 12 */ { "lea",         "de,ix%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 13 */ { "lea",         "de,iy%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 14 */ { "tst",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 15 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 16 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 17 */ { "ld",          "de,(hl)",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 18 */ { "in0",         "e,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 19 */ { "out0",        "(%n),e",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 1A */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1B */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1C */ { "tst",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1E */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1F */ { "ld",          "(hl),de",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 20 */ { "in0",         "h,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 21 */ { "out0",        "(%n),h",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 22 */ { "lea",         "hl,ix%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 23 */ { "lea",         "hl,iy%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 24 */ { "tst",         "a,h",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 25 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 26 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 27 */ { "ld",          "hl,(hl)",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 28 */ { "in0",         "l,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 29 */ { "out0",        "(%n),l",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 2A */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2B */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2C */ { "tst",         "a,l",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2E */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2F */ { "ld",          "(hl),hl",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 30 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 31 */ { "ld",          "iy,(hl)",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 32 */ { "lea",         "ix,ix%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 33 */ { "lea",         "iy,iy%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 34 */ { "tst",         "a,(hl)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 35 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 36 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 37 */ { "ld",          "ix,(hl)",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 38 */ { "in0",         "a,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 39 */ { "out0",        "(%n),a",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 3A */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3B */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3C */ { "tst",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3E */ { "ld",          "(hl),iy",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 3F */ { "ld",          "(hl),ix",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 40 */ { "in",          "b,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 41 */ { "out",         "(bc),b",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 42 */ { "sbc",         "hl,bc",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 43 */ { "ld",          "(%w),bc",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 44 */ { "neg",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 45 */ { "retn",        "",          OPCODE_NONE,        OPCODE_FLOW_RETURN,   0,                  { 1, 1, 0, 1, 0, 0 }, { 1, 1, 0, 1, 0, 0 } },
+    /* 46 */ { "im",          "0",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 47 */ { "ld",          "i,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 48 */ { "in",          "c,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 49 */ { "out",         "(bc),c",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 4A */ { "adc",         "hl,bc",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4B */ { "ld",          "bc,(%w)",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 4C */ { "mlt",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0, 0 } },
+    /* 4D */ { "reti",        "",          OPCODE_NONE,        OPCODE_FLOW_RETURN,   0,                  { 1, 1, 0, 1, 0, 0 }, { 1, 1, 0, 1, 0, 0 } },
+    /* 4E */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4F */ { "ld",          "r,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 50 */ { "in",          "d,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 51 */ { "out",         "(bc),d",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 52 */ { "sbc",         "hl,de",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 53 */ { "ld",          "(%w),de",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 54 */ { "lea",         "ix,iy%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 55 */ { "lea",         "iy,ix%d",   OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 56 */ { "im",          "1",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 57 */ { "ld",          "a,i",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 58 */ { "in",          "e,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 59 */ { "out",         "(bc),e",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 5A */ { "adc",         "hl,de",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5B */ { "ld",          "de,(%w)",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 5C */ { "mlt",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0, 0 } },
+    /* 5D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5E */ { "im",          "2",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5F */ { "ld",          "a,r",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 60 */ { "in",          "h,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 61 */ { "out",         "(bc),h",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 62 */ { "sbc",         "hl,hl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 63 */ { "ld",          "(%w),hl",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 64 */ { "tst",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 65 */ { "pea",         "ix%d",      OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 66 */ { "pea",         "iy%d",      OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 67 */ { "rrd",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 68 */ { "in",          "l,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 69 */ { "out",         "(bc),l",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 6A */ { "adc",         "hl,hl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6B */ { "ld",          "hl,(%w)",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 6C */ { "mlt",         "hl",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0, 0 } },
+    /* 6D */ { "ld",          "mb,a",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_LONG,        { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6E */ { "ld",          "a,mb",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_LONG,        { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6F */ { "rld",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 70 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 71 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 72 */ { "sbc",         "hl,sp",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 73 */ { "ld",          "(%w),sp",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 74 */ { "tstio",       "%n",        OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 75 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 76 */ { "slp",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 77 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 78 */ { "in",          "a,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* 79 */ { "out",         "(bc),a",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* 7A */ { "adc",         "hl,sp",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7B */ { "ld",          "sp,(%w)",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 7C */ { "mlt",         "sp",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 0, 0, 0, 0 }, { 4, 0, 0, 0, 0, 0 } },
+    /* 7D */ { "stmix",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7E */ { "rsmix",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7F */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 80 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 81 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 82 */ { "inim",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 83 */ { "otim",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* 84 */ { "ini2",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 85 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 86 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 87 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 88 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 89 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8A */ { "indm",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 8B */ { "otdm",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* 8C */ { "ind2",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 8D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8E */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8F */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 90 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 91 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 92 */ { "inimr",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 93 */ { "otimr",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* 94 */ { "ini2r",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 95 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 96 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 97 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 98 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 99 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9A */ { "indmr",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 9B */ { "otdmr",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* 9C */ { "ind2r",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* 9D */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9E */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9F */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A0 */ { "ldi",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* A1 */ { "cpi",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* A2 */ { "ini",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* A3 */ { "outi",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* A4 */ { "outi2",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* A5 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A6 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A7 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A8 */ { "ldd",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* A9 */ { "cpd",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* AA */ { "ind",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* AB */ { "outd",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* AC */ { "outd2",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* AD */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AE */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AF */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B0 */ { "ldir",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* B1 */ { "cpir",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 1, 0, 1, 0, 0, 0 }, { 2, 0, 1, 0, 0, 0 } },
+    /* B2 */ { "inir",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* B3 */ { "otir",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* B4 */ { "oti2r",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* B5 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B6 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B7 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B8 */ { "lddr",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* B9 */ { "cpdr",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 1, 0, 1, 0, 0, 0 }, { 2, 0, 1, 0, 0, 0 } },
+    /* BA */ { "indr",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* BB */ { "otdr",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* BC */ { "otdr2",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* BD */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BE */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BF */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C0 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C1 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C2 */ { "inirx",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* C3 */ { "otirx",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* C4 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C5 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C6 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C7 */ { "ld",          "i,hl",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C8 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C9 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CA */ { "indrx",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 3, 0, 0, 0, 1, 0 }, { 3, 0, 0, 0, 1, 0 } },
+    /* CB */ { "otdrx",       "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     OPCODE_REPEAT,      { 4, 0, 1, 0, 0, 0 }, { 4, 0, 1, 0, 0, 0 } },
+    /* CC */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CD */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CE */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CF */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D0 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D1 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D2 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D3 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D4 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D5 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D6 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D7 */ { "ld",          "hl,i",      OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D8 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D9 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DA */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DB */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DC */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DD */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DE */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DF */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E0 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E1 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E2 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E3 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E4 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E5 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E6 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E7 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E8 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E9 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EA */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EB */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EC */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* ED */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EE */ { "FLASH_ERASE", "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EF */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F0 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F1 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F2 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F3 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F4 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F5 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F6 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F7 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F8 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F9 */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FA */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FB */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FC */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FD */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FE */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FF */ { "OPCODETRAP",  "",          OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+};
+
+const opcode_t opcode_index[256] = {
+    /* 00 */ { "nop",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 01 */ { "ld",          "bc,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 02 */ { "ld",          "(bc),a",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 03 */ { "inc",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 04 */ { "inc",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 05 */ { "dec",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 06 */ { "ld",          "b,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 07 */ { "ld",          "bc,(%x%d)", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 08 */ { "ex",          "af,af'",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 09 */ { "add",         "%x,bc",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0A */ { "ld",          "a,(bc)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 0B */ { "dec",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0C */ { "inc",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0D */ { "dec",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0E */ { "ld",          "c,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0F */ { "ld",          "(%x%d),bc", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 10 */ { "djnz",        "%w",        OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 11 */ { "ld",          "de,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 12 */ { "ld",          "(de),a",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 13 */ { "inc",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 14 */ { "inc",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 15 */ { "dec",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 16 */ { "ld",          "d,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 17 */ { "ld",          "de,(%x%d)", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 18 */ { "jr",          "%w",        OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     0,                  { 0, 1, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0, 0 } },
+    /* 19 */ { "add",         "%x,de",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1A */ { "ld",          "a,(de)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 1B */ { "dec",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1C */ { "inc",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1D */ { "dec",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1E */ { "ld",          "e,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1F */ { "ld",          "(%x%d),de", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 20 */ { "jr",          "nz,%w",     OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 21 */ { "ld",          "%x,%w",     OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 22 */ { "ld",          "(%w),%x",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 23 */ { "inc",         "%x",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 24 */ { "inc",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 25 */ { "dec",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 26 */ { "ld",          "%xh,%n",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 27 */ { "ld",          "hl,(%x%d)", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 28 */ { "jr",          "z,%w",      OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 29 */ { "add",         "%x,%x",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2A */ { "ld",          "%x,(%w)",   OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 2B */ { "dec",         "%x",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2C */ { "inc",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2D */ { "dec",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2E */ { "ld",          "%xl,%n",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2F */ { "ld",          "(%x%d),hl", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 30 */ { "jr",          "nc,%w",     OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 31 */ { "ld",          "%y,(%x%d)", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 32 */ { "ld",          "(%w),a",    OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 33 */ { "inc",         "sp",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 34 */ { "inc",         "(%x%d)",    OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 35 */ { "dec",         "(%x%d)",    OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 36 */ { "ld",          "(%x%d),%n", OPCODE_OFFSET_BYTE, OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 37 */ { "ld",          "%x,(%x%d)", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* 38 */ { "jr",          "c,%w",      OPCODE_RELATIVE,    OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 1, 0, 0, 0, 0 } },
+    /* 39 */ { "add",         "%x,sp",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3A */ { "ld",          "a,(%w)",    OPCODE_WORD,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 3B */ { "dec",         "sp",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3C */ { "inc",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3D */ { "dec",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3E */ { "ld",          "(%x%d),%y", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 3F */ { "ld",          "(%x%d),%x", OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* 40 */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 41 */ { "ld",          "b,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 42 */ { "ld",          "b,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 43 */ { "ld",          "b,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 44 */ { "ld",          "b,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 45 */ { "ld",          "b,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 46 */ { "ld",          "b,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 47 */ { "ld",          "b,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 48 */ { "ld",          "c,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 49 */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4A */ { "ld",          "c,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4B */ { "ld",          "c,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4C */ { "ld",          "c,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4D */ { "ld",          "c,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4E */ { "ld",          "c,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 4F */ { "ld",          "c,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 50 */ { "ld",          "d,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 51 */ { "ld",          "d,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 52 */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 53 */ { "ld",          "d,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 54 */ { "ld",          "d,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 55 */ { "ld",          "d,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 56 */ { "ld",          "d,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 57 */ { "ld",          "d,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 58 */ { "ld",          "e,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 59 */ { "ld",          "e,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5A */ { "ld",          "e,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5B */ { NULL,          NULL,        OPCODE_SUFFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5C */ { "ld",          "e,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5D */ { "ld",          "e,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5E */ { "ld",          "e,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 5F */ { "ld",          "e,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 60 */ { "ld",          "%xh,b",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 61 */ { "ld",          "%xh,c",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 62 */ { "ld",          "%xh,d",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 63 */ { "ld",          "%xh,e",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 64 */ { "ld",          "%xh,%xh",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 65 */ { "ld",          "%xh,%xl",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 66 */ { "ld",          "h,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 67 */ { "ld",          "%xh,a",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 68 */ { "ld",          "%xl,b",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 69 */ { "ld",          "%xl,c",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6A */ { "ld",          "%xl,d",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6B */ { "ld",          "%xl,e",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6C */ { "ld",          "%xl,%xh",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6D */ { "ld",          "%xl,%xl",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6E */ { "ld",          "l,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 6F */ { "ld",          "%xl,a",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 70 */ { "ld",          "(%x%d),b",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 71 */ { "ld",          "(%x%d),c",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 72 */ { "ld",          "(%x%d),d",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 73 */ { "ld",          "(%x%d),e",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 74 */ { "ld",          "(%x%d),h",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 75 */ { "ld",          "(%x%d),l",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 76 */ { "halt",        "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 77 */ { "ld",          "(%x%d),a",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 1, 0 }, { 0, 0, 0, 0, 1, 0 } },
+    /* 78 */ { "ld",          "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 79 */ { "ld",          "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7A */ { "ld",          "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7B */ { "ld",          "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7C */ { "ld",          "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7D */ { "ld",          "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7E */ { "ld",          "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 7F */ { "ld",          "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 80 */ { "add",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 81 */ { "add",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 82 */ { "add",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 83 */ { "add",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 84 */ { "add",         "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 85 */ { "add",         "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 86 */ { "add",         "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 87 */ { "add",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 88 */ { "adc",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 89 */ { "adc",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8A */ { "adc",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8B */ { "adc",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8C */ { "adc",         "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8D */ { "adc",         "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8E */ { "adc",         "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 8F */ { "adc",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 90 */ { "sub",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 91 */ { "sub",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 92 */ { "sub",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 93 */ { "sub",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 94 */ { "sub",         "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 95 */ { "sub",         "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 96 */ { "sub",         "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 97 */ { "sub",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 98 */ { "sbc",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 99 */ { "sbc",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9A */ { "sbc",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9B */ { "sbc",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9C */ { "sbc",         "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9D */ { "sbc",         "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9E */ { "sbc",         "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 9F */ { "sbc",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A0 */ { "and",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A1 */ { "and",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A2 */ { "and",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A3 */ { "and",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A4 */ { "and",         "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A5 */ { "and",         "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A6 */ { "and",         "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* A7 */ { "and",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A8 */ { "xor",         "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A9 */ { "xor",         "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AA */ { "xor",         "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AB */ { "xor",         "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AC */ { "xor",         "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AD */ { "xor",         "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AE */ { "xor",         "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* AF */ { "xor",         "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B0 */ { "or",          "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B1 */ { "or",          "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B2 */ { "or",          "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B3 */ { "or",          "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B4 */ { "or",          "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B5 */ { "or",          "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B6 */ { "or",          "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* B7 */ { "or",          "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B8 */ { "cp",          "a,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B9 */ { "cp",          "a,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BA */ { "cp",          "a,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BB */ { "cp",          "a,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BC */ { "cp",          "a,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BD */ { "cp",          "a,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BE */ { "cp",          "a,(%x%d)",  OPCODE_OFFSET,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* BF */ { "cp",          "a,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C0 */ { "ret",         "nz",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* C1 */ { "pop",         "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* C2 */ { "jp",          "nz,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* C3 */ { "jp",          "%w",        OPCODE_WORD,        OPCODE_FLOW_JUMP,     0,                  { 1, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* C4 */ { "call",        "nz,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* C5 */ { "push",        "bc",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* C6 */ { "add",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* C8 */ { "ret",         "z",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* C9 */ { "ret",         "",          OPCODE_NONE,        OPCODE_FLOW_RETURN,   0,                  { 1, 1, 0, 1, 0, 0 }, { 1, 1, 0, 1, 0, 0 } },
+    /* CA */ { "jp",          "z,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* CB */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CC */ { "call",        "z,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* CD */ { "call",        "%w",        OPCODE_WORD,        OPCODE_FLOW_CALL,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* CE */ { "adc",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* D0 */ { "ret",         "nc",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* D1 */ { "pop",         "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* D2 */ { "jp",          "nc,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* D3 */ { "out",         "(%n),a",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 3, 0, 0, 0, 0, 0 }, { 3, 0, 0, 0, 0, 0 } },
+    /* D4 */ { "call",        "nc,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* D5 */ { "push",        "de",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* D6 */ { "sub",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* D8 */ { "ret",         "c",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* D9 */ { "exx",         "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DA */ { "jp",          "c,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* DB */ { "in",          "a,(%n)",    OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 2, 0, 0, 0, 0, 0 }, { 2, 0, 0, 0, 0, 0 } },
+    /* DC */ { "call",        "c,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* DD */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DE */ { "sbc",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* E0 */ { "ret",         "po",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* E1 */ { "pop",         "%x",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* E2 */ { "jp",          "po,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* E3 */ { "ex",          "(sp),%x",   OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 1 }, { 0, 0, 0, 1, 0, 1 } },
+    /* E4 */ { "call",        "po,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* E5 */ { "push",        "%x",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* E6 */ { "and",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* E8 */ { "ret",         "pe",        OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* E9 */ { "jp",          "(%x)",      OPCODE_NONE,        OPCODE_FLOW_INDIRECT, 0,                  { 0, 2, 0, 0, 0, 0 }, { 0, 2, 0, 0, 0, 0 } },
+    /* EA */ { "jp",          "pe,%w",     OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* EB */ { "ex",          "de,hl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EC */ { "call",        "pe,%w",     OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* ED */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EE */ { "xor",         "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* F0 */ { "ret",         "p",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* F1 */ { "pop",         "af",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 1, 0, 0 }, { 0, 0, 0, 1, 0, 0 } },
+    /* F2 */ { "jp",          "p,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* F3 */ { "di",          "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F4 */ { "call",        "p,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* F5 */ { "push",        "af",        OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 1 }, { 0, 0, 0, 0, 0, 1 } },
+    /* F6 */ { "or",          "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F7 */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+    /* F8 */ { "ret",         "m",         OPCODE_NONE,        OPCODE_FLOW_RETURN,   OPCODE_CONDITIONAL, { 1, 0, 0, 0, 0, 0 }, { 2, 1, 0, 1, 0, 0 } },
+    /* F9 */ { "ld",          "sp,%x",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FA */ { "jp",          "m,%w",      OPCODE_WORD,        OPCODE_FLOW_JUMP,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0, 0 } },
+    /* FB */ { "ei",          "",          OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FC */ { "call",        "m,%w",      OPCODE_WORD,        OPCODE_FLOW_CALL,     OPCODE_CONDITIONAL, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 1 } },
+    /* FD */ { NULL,          NULL,        OPCODE_PREFIX,      OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FE */ { "cp",          "a,%n",      OPCODE_BYTE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FF */ { "rst",         "%w",        OPCODE_RESTART,     OPCODE_FLOW_CALL,     0,                  { 1, 1, 0, 0, 0, 1 }, { 1, 1, 0, 0, 0, 1 } },
+};
+
+const opcode_t opcode_index_cb[256] = {
+    /* 00 */ { "rlc",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 01 */ { "rlc",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 02 */ { "rlc",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 03 */ { "rlc",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 04 */ { "rlc",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 05 */ { "rlc",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 06 */ { "rlc",         "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 07 */ { "rlc",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 08 */ { "rrc",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 09 */ { "rrc",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0A */ { "rrc",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0B */ { "rrc",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0C */ { "rrc",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0D */ { "rrc",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 0E */ { "rrc",         "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 0F */ { "rrc",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 10 */ { "rl",          "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 11 */ { "rl",          "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 12 */ { "rl",          "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 13 */ { "rl",          "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 14 */ { "rl",          "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 15 */ { "rl",          "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 16 */ { "rl",          "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 17 */ { "rl",          "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 18 */ { "rr",          "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 19 */ { "rr",          "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1A */ { "rr",          "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1B */ { "rr",          "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1C */ { "rr",          "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1D */ { "rr",          "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 1E */ { "rr",          "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 1F */ { "rr",          "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 20 */ { "sla",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 21 */ { "sla",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 22 */ { "sla",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 23 */ { "sla",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 24 */ { "sla",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 25 */ { "sla",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 26 */ { "sla",         "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 27 */ { "sla",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 28 */ { "sra",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 29 */ { "sra",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2A */ { "sra",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2B */ { "sra",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2C */ { "sra",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2D */ { "sra",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 2E */ { "sra",         "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 2F */ { "sra",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 30 */ { "OPCODETRAP",  "b",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 31 */ { "OPCODETRAP",  "c",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 32 */ { "OPCODETRAP",  "d",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 33 */ { "OPCODETRAP",  "e",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 34 */ { "OPCODETRAP",  "%xh",       OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 35 */ { "OPCODETRAP",  "%xl",       OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 36 */ { "OPCODETRAP",  "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 37 */ { "OPCODETRAP",  "a",         OPCODE_NONE,        OPCODE_FLOW_TRAP,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 38 */ { "srl",         "b",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 39 */ { "srl",         "c",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3A */ { "srl",         "d",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3B */ { "srl",         "e",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3C */ { "srl",         "%xh",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3D */ { "srl",         "%xl",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 3E */ { "srl",         "(%x%d)",    OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 1, 0 }, { 0, 0, 1, 0, 1, 0 } },
+    /* 3F */ { "srl",         "a",         OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 40 */ { "bit",         "0,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 41 */ { "bit",         "0,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 42 */ { "bit",         "0,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 43 */ { "bit",         "0,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 44 */ { "bit",         "0,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 45 */ { "bit",         "0,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 46 */ { "bit",         "0,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 47 */ { "bit",         "0,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 48 */ { "bit",         "1,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 49 */ { "bit",         "1,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4A */ { "bit",         "1,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4B */ { "bit",         "1,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4C */ { "bit",         "1,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4D */ { "bit",         "1,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 4E */ { "bit",         "1,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 4F */ { "bit",         "1,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 50 */ { "bit",         "2,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 51 */ { "bit",         "2,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 52 */ { "bit",         "2,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 53 */ { "bit",         "2,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 54 */ { "bit",         "2,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 55 */ { "bit",         "2,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 56 */ { "bit",         "2,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 57 */ { "bit",         "2,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 58 */ { "bit",         "3,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 59 */ { "bit",         "3,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5A */ { "bit",         "3,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5B */ { "bit",         "3,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5C */ { "bit",         "3,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5D */ { "bit",         "3,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 5E */ { "bit",         "3,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 5F */ { "bit",         "3,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 60 */ { "bit",         "4,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 61 */ { "bit",         "4,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 62 */ { "bit",         "4,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 63 */ { "bit",         "4,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 64 */ { "bit",         "4,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 65 */ { "bit",         "4,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 66 */ { "bit",         "4,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 67 */ { "bit",         "4,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 68 */ { "bit",         "5,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 69 */ { "bit",         "5,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6A */ { "bit",         "5,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6B */ { "bit",         "5,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6C */ { "bit",         "5,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6D */ { "bit",         "5,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 6E */ { "bit",         "5,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 6F */ { "bit",         "5,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 70 */ { "bit",         "6,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 71 */ { "bit",         "6,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 72 */ { "bit",         "6,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 73 */ { "bit",         "6,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 74 */ { "bit",         "6,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 75 */ { "bit",         "6,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 76 */ { "bit",         "6,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 77 */ { "bit",         "6,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 78 */ { "bit",         "7,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 79 */ { "bit",         "7,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7A */ { "bit",         "7,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7B */ { "bit",         "7,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7C */ { "bit",         "7,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7D */ { "bit",         "7,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 7E */ { "bit",         "7,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 1, 0, 0, 0 }, { 0, 0, 1, 0, 0, 0 } },
+    /* 7F */ { "bit",         "7,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 80 */ { "res",         "0,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 81 */ { "res",         "0,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 82 */ { "res",         "0,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 83 */ { "res",         "0,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 84 */ { "res",         "0,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 85 */ { "res",         "0,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 86 */ { "res",         "0,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 87 */ { "res",         "0,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 88 */ { "res",         "1,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 89 */ { "res",         "1,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8A */ { "res",         "1,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8B */ { "res",         "1,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8C */ { "res",         "1,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8D */ { "res",         "1,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 8E */ { "res",         "1,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 8F */ { "res",         "1,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 90 */ { "res",         "2,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 91 */ { "res",         "2,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 92 */ { "res",         "2,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 93 */ { "res",         "2,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 94 */ { "res",         "2,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 95 */ { "res",         "2,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 96 */ { "res",         "2,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 97 */ { "res",         "2,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 98 */ { "res",         "3,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 99 */ { "res",         "3,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9A */ { "res",         "3,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9B */ { "res",         "3,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9C */ { "res",         "3,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9D */ { "res",         "3,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* 9E */ { "res",         "3,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* 9F */ { "res",         "3,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A0 */ { "res",         "4,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A1 */ { "res",         "4,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A2 */ { "res",         "4,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A3 */ { "res",         "4,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A4 */ { "res",         "4,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A5 */ { "res",         "4,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A6 */ { "res",         "4,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* A7 */ { "res",         "4,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A8 */ { "res",         "5,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* A9 */ { "res",         "5,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AA */ { "res",         "5,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AB */ { "res",         "5,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AC */ { "res",         "5,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AD */ { "res",         "5,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* AE */ { "res",         "5,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* AF */ { "res",         "5,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B0 */ { "res",         "6,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B1 */ { "res",         "6,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B2 */ { "res",         "6,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B3 */ { "res",         "6,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B4 */ { "res",         "6,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B5 */ { "res",         "6,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B6 */ { "res",         "6,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* B7 */ { "res",         "6,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B8 */ { "res",         "7,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* B9 */ { "res",         "7,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BA */ { "res",         "7,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BB */ { "res",         "7,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BC */ { "res",         "7,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BD */ { "res",         "7,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* BE */ { "res",         "7,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* BF */ { "res",         "7,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C0 */ { "set",         "0,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C1 */ { "set",         "0,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C2 */ { "set",         "0,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C3 */ { "set",         "0,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C4 */ { "set",         "0,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C5 */ { "set",         "0,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C6 */ { "set",         "0,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* C7 */ { "set",         "0,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C8 */ { "set",         "1,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* C9 */ { "set",         "1,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CA */ { "set",         "1,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CB */ { "set",         "1,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CC */ { "set",         "1,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CD */ { "set",         "1,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* CE */ { "set",         "1,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* CF */ { "set",         "1,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D0 */ { "set",         "2,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D1 */ { "set",         "2,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D2 */ { "set",         "2,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D3 */ { "set",         "2,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D4 */ { "set",         "2,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D5 */ { "set",         "2,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D6 */ { "set",         "2,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* D7 */ { "set",         "2,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D8 */ { "set",         "3,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* D9 */ { "set",         "3,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DA */ { "set",         "3,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DB */ { "set",         "3,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DC */ { "set",         "3,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DD */ { "set",         "3,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* DE */ { "set",         "3,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* DF */ { "set",         "3,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E0 */ { "set",         "4,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E1 */ { "set",         "4,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E2 */ { "set",         "4,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E3 */ { "set",         "4,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E4 */ { "set",         "4,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E5 */ { "set",         "4,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E6 */ { "set",         "4,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* E7 */ { "set",         "4,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E8 */ { "set",         "5,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* E9 */ { "set",         "5,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EA */ { "set",         "5,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EB */ { "set",         "5,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EC */ { "set",         "5,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* ED */ { "set",         "5,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* EE */ { "set",         "5,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* EF */ { "set",         "5,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F0 */ { "set",         "6,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F1 */ { "set",         "6,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F2 */ { "set",         "6,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F3 */ { "set",         "6,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F4 */ { "set",         "6,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F5 */ { "set",         "6,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F6 */ { "set",         "6,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* F7 */ { "set",         "6,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F8 */ { "set",         "7,b",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* F9 */ { "set",         "7,c",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FA */ { "set",         "7,d",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FB */ { "set",         "7,e",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FC */ { "set",         "7,%xh",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FD */ { "set",         "7,%xl",     OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+    /* FE */ { "set",         "7,(%x%d)",  OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 1, 0, 1, 0, 1, 0 }, { 1, 0, 1, 0, 1, 0 } },
+    /* FF */ { "set",         "7,a",       OPCODE_NONE,        OPCODE_FLOW_NEXT,     0,                  { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 } },
+};
+static const opcode_t opcode_trap = {
+    "OPCODETRAP", "", OPCODE_NONE, OPCODE_FLOW_TRAP, 0, { 0, 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0, 0 }
+};
+
+void opcode_decode(opcode_inst_t *inst, uint32_t address, bool adl, opcode_read_t read, void *context) {
+    const opcode_t *table = opcode_main;
+    const opcode_t *opcode;
+    uint32_t pc = address;
+    uint8_t op;
+
+    inst->prefix = 0;
+    inst->suffix = 0;
+    inst->adl = adl;
+    inst->l = adl;
+    inst->il = adl;
+    inst->offset = 0;
+    inst->byte = 0;
+    inst->word = 0;
+
+    /* Prefixes and suffixes can come in any number, the last of each kind counting */
+    for (;;) {
+        op = read(context, pc++);
+        opcode = &table[op];
+        if (opcode->kind == OPCODE_SUFFIX) {
+            inst->suffix = op;
+            inst->l = op & 1;
+            inst->il = op >> 1 & 1;
+        } else if (opcode->kind != OPCODE_PREFIX) {
+            break;
+        } else if (op == 0xED) {
+            inst->prefix = 0;
+            table = opcode_ed;
+        } else if (op != 0xCB) {
+            inst->prefix = op == 0xDD ? 2 : 3;
+            table = opcode_index;
+        } else if (inst->prefix) {
+            /* The offset comes before the opcode */
+            inst->offset = (int8_t)read(context, pc++);
+            table = opcode_index_cb;
+        } else {
+            table = opcode_cb;
+        }
+    }
+
+    switch (opcode->kind) {
+        case OPCODE_BYTE:
+            inst->byte = read(context, pc++);
+            break;
+        case OPCODE_OFFSET:
+            inst->offset = (int8_t)read(context, pc++);
+            break;
+        case OPCODE_OFFSET_BYTE:
+            inst->offset = (int8_t)read(context, pc++);
+            inst->byte = read(context, pc++);
+            break;
+        case OPCODE_RELATIVE:
+            inst->offset = (int8_t)read(context, pc++);
+            inst->word = pc + inst->offset;
+            break;
+        case OPCODE_WORD:
+            inst->word = read(context, pc++);
+            inst->word |= read(context, pc++) << 8;
+            if (inst->il) {
+                inst->word |= read(context, pc++) << 16;
+            }
+            break;
+        case OPCODE_RESTART:
+            inst->word = op & 0x38;
+            break;
+        default:
+            break;
+    }
+
+    if ((opcode->flags & OPCODE_LONG) && !inst->il) {
+        opcode = &opcode_trap;
+    }
+    inst->opcode = opcode;
+    inst->size = pc - address;
+}
+
+/* Where the CPU takes an address to, long or in the 64K MBASE selects */
+static uint32_t opcode_address(uint32_t value, bool mode) {
+    return mode ? value & 0xFFFFFF : (uint32_t)cpu.registers.MBASE << 16 | (value & 0xFFFF);
+}
+
+uint32_t opcode_cycles(const opcode_inst_t *inst, uint32_t address, bool taken) {
+    const opcode_t *opcode = inst->opcode;
+    const opcode_cost_t *cost = taken ? &opcode->taken : &opcode->cost;
+    uint32_t word = inst->l ? 3 : 2;
+    uint32_t data = 0xD00000;
+    uint32_t target = address;
+    uint32_t cycles = cost->cycles;
+    uint32_t reads = cost->reads + cost->read_words * word;
+    uint32_t writes = cost->writes + cost->write_words * word;
+    uint32_t fetches;
+
+    /* Relative jumps wrap at the data size, jumps go to the data size's mode and calls to the immediate size's */
+    if (opcode->kind == OPCODE_RELATIVE) {
+        target = opcode_address(inst->l ? inst->word : inst->word & 0xFFFF, inst->adl);
+    } else if (opcode->kind == OPCODE_RESTART || (opcode->kind == OPCODE_WORD && opcode->flow == OPCODE_FLOW_CALL)) {
+        target = opcode_address(inst->word, inst->il);
+    } else if (opcode->kind == OPCODE_WORD && opcode->flow == OPCODE_FLOW_JUMP) {
+        target = opcode_address(inst->word, inst->l);
+    } else if (opcode->kind == OPCODE_WORD) {
+        data = opcode_address(inst->word, inst->l);
+    }
+
+    /* With a suffix, calls and returns keep the mode on the stack next to the address */
+    if (inst->suffix && opcode->flow == OPCODE_FLOW_CALL && cost->write_words) {
+        writes = cost->writes + 3 + inst->adl;
+    } else if (inst->suffix && opcode->flow == OPCODE_FLOW_RETURN && cost->read_words) {
+        reads = cost->reads + 3 + inst->adl;
+    }
+
+    /* The last byte fetched is the first of whatever runs next. Block instructions don't fetch to go round */
+    fetches = cost->fetches;
+    if (!(opcode->flags & OPCODE_REPEAT) || !taken) {
+        fetches += inst->size;
+    }
+    if (fetches && opcode->flow != OPCODE_FLOW_NEXT && (taken || !(opcode->flags & OPCODE_CONDITIONAL))) {
+        cycles += mem_access_cycles(target, false);
+        fetches--;
+    }
+    cycles += fetches * mem_access_cycles(address, false);
+    cycles += reads * mem_access_cycles(data, false);
+    cycles += writes * mem_access_cycles(data, true);
+    return cycles;
+}
+
+const char *const opcode_suffixes[4] = {
+    ".sis ",
+    ".lis ",
+    ".sil ",
+    ".lil ",
+};
+
+static const char *const opcode_index_names[4] = {
+    "hl",
+    "i",
+    "ix",
+    "iy",
+};
+
+void opcode_operands(const opcode_inst_t *inst, char *out, size_t size, opcode_word_t word, void *context) {
+    const char *format = inst->opcode->operands;
+    char part[32];
+    size_t length = 0;
+
+    if (!size) {
+        return;
+    }
+    for (; *format && length < size - 1; format++) {
+        const char *text = part;
+        size_t count;
+        if (*format != '%') {
+            out[length++] = *format;
+            continue;
+        }
+        switch (*++format) {
+            case 'n':
+                snprintf(part, sizeof(part), "$%02X", inst->byte);
+                break;
+            case 'd':
+                if (inst->offset < 0) {
+                    snprintf(part, sizeof(part), "-$%02X", -inst->offset);
+                } else if (inst->offset) {
+                    snprintf(part, sizeof(part), "+$%02X", inst->offset);
+                } else {
+                    part[0] = '\0';
+                }
+                break;
+            case 'w':
+                if (!word || !(text = word(context, inst->word))) {
+                    snprintf(part, sizeof(part), "$%0*X", inst->il ? 6 : 4, inst->word);
+                    text = part;
+                }
+                break;
+            case 'x': text = opcode_index_names[inst->prefix]; break;
+            case 'y': text = opcode_index_names[inst->prefix ^ 1]; break;
+            default: abort();
+        }
+        count = strlen(text);
+        if (count > size - 1 - length) {
+            count = size - 1 - length;
+        }
+        memcpy(out + length, text, count);
+        length += count;
+    }
+    out[length] = '\0';
+}
+
+#endif
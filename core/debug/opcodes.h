@@ -0,0 +1,114 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef OPCODES_H
+#define OPCODES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * One description of every eZ80 instruction, for everything that takes instructions apart outside of the CPU
+ * itself: the disassembler, stepping, ROM analysis and cycle counts. There is a table for each opcode page;
+ * the index pages serve both ix and iy.
+ */
+
+/* What follows the opcode */
+typedef enum {
+    OPCODE_NONE,
+    OPCODE_BYTE,            /* n */
+    OPCODE_OFFSET,          /* d, added to the index register */
+    OPCODE_OFFSET_BYTE,     /* d, then n */
+    OPCODE_RELATIVE,        /* e, a jump from the next instruction */
+    OPCODE_WORD,            /* nn, three bytes with long immediates and two otherwise */
+    OPCODE_RESTART,         /* Nothing, the target is part of the opcode */
+    OPCODE_PREFIX,          /* Not an instruction, selects another page */
+    OPCODE_SUFFIX           /* Not an instruction, sets the data and immediate sizes */
+} opcode_operands_t;
+
+typedef enum {
+    OPCODE_FLOW_NEXT,
+    OPCODE_FLOW_JUMP,
+    OPCODE_FLOW_CALL,
+    OPCODE_FLOW_RETURN,
+    OPCODE_FLOW_INDIRECT,   /* Jumps somewhere that can't be known from the bytes */
+    OPCODE_FLOW_TRAP
+} opcode_flow_t;
+
+#define OPCODE_CONDITIONAL (1 << 0)     /* Only jumps, calls or returns when the condition holds */
+#define OPCODE_REPEAT      (1 << 1)     /* Block instruction that goes round until its counter runs out */
+#define OPCODE_LONG        (1 << 2)     /* A trap unless immediates are long */
+
+/*
+ * Cycles as the emulator counts them: those spent in the CPU itself, on top of what every memory access costs
+ * where it goes. Each byte of the instruction is fetched once. Word accesses are three bytes with long data
+ * and two otherwise.
+ */
+typedef struct {
+    uint8_t cycles;
+    uint8_t fetches;        /* Bytes fetched beyond the instruction itself */
+    uint8_t reads;          /* Data bytes read */
+    uint8_t read_words;
+    uint8_t writes;
+    uint8_t write_words;
+} opcode_cost_t;
+
+typedef struct {
+    const char *mnemonic;
+    const char *operands;   /* %n byte, %d offset, %w word or target, %x index register and %y the other one */
+    uint8_t kind;           /* opcode_operands_t */
+    uint8_t flow;           /* opcode_flow_t */
+    uint8_t flags;
+    opcode_cost_t cost;     /* Carrying on to the next instruction, or always when unconditional */
+    opcode_cost_t taken;    /* When the condition holds, or for each further round of a block instruction */
+} opcode_t;
+
+extern const opcode_t opcode_main[256];
+extern const opcode_t opcode_cb[256];
+extern const opcode_t opcode_ed[256];
+extern const opcode_t opcode_index[256];
+extern const opcode_t opcode_index_cb[256];
+
+typedef struct {
+    const opcode_t *opcode;
+    uint32_t size;
+    uint8_t prefix;         /* 0, or 2 for ix and 3 for iy */
+    uint8_t suffix;         /* The last mode suffix, or 0 */
+    bool adl;               /* The mode it was decoded in */
+    bool l, il;             /* Long data and long immediates */
+    int8_t offset;
+    uint8_t byte;
+    uint32_t word;          /* The immediate word, or where a relative jump or restart goes */
+} opcode_inst_t;
+
+typedef uint8_t (*opcode_read_t)(void *context, uint32_t address);
+
+/* Decode the instruction at address, reading each of its bytes in order through read */
+void opcode_decode(opcode_inst_t *inst, uint32_t address, bool adl, opcode_read_t read, void *context);
+/*
+ * Cycles the decoded instruction takes at address with memory timed as it is now: carrying on, or taken, which
+ * for block instructions is each further round. Data is taken to be in RAM unless its address is in the
+ * instruction, and returns go back to the same region and mode. Z80 mode addresses are in the 64K MBASE selects.
+ */
+uint32_t opcode_cycles(const opcode_inst_t *inst, uint32_t address, bool taken);
+
+/* The mode suffixes as shown, indexed by il << 1 | l */
+extern const char *const opcode_suffixes[4];
+
+/* Gives the text for an immediate word or target, or NULL to show it in hex */
+typedef const char *(*opcode_word_t)(void *context, uint32_t word);
+
+/* Fill in the operand template of the decoded instruction, with words shown through word if it isn't NULL */
+void opcode_operands(const opcode_inst_t *inst, char *out, size_t size, opcode_word_t word, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,419 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "profiler.h"
+#include "debug.h"
+#include "symbols.h"
+#include "analysis.h"
+#include "../cpu.h"
+#include "../schedule.h"
+#include "../os/os.h"
+
+#define PROFILER_PAGES        0x10000
+#define PROFILER_PAGE_SIZE    0x100
+#define PROFILER_DEPTH        1024    /* Calls deeper than this aren't followed */
+#define PROFILER_SYMBOL_RANGE 0xFF    /* Furthest a function is named after a symbol before it, as symbol+offset */
+
+profiler_t profiler;
+
+typedef struct {
+    uint64_t cycles[PROFILER_PAGE_SIZE];
+    uint64_t count[PROFILER_PAGE_SIZE];     /* Instructions run, or samples taken */
+} profiler_page_t;
+
+/* Every place a call was made from to every place it went */
+typedef struct {
+    uint32_t site;
+    uint32_t target;
+    uint64_t calls;
+    uint64_t cycles, count;                 /* Inclusive, for the calls that returned */
+} profiler_edge_t;
+
+typedef struct {
+    uint32_t edge;
+    uint32_t sp;                            /* After pushing the return address */
+    bool stack;                             /* SPL rather than SPS */
+    uint64_t cycles, count;                 /* When the call was made */
+} profiler_frame_t;
+
+static struct {
+    uint32_t mode;                          /* What the results were gathered with */
+    bool started;
+    uint64_t instructions;
+    profiler_page_t *pages[PROFILER_PAGES];
+    profiler_edge_t *edges;
+    uint32_t edge_count;
+    uint32_t *slots;                        /* Hash of edge index plus one, or 0 when free */
+    uint32_t slot_mask;
+    profiler_frame_t frames[PROFILER_DEPTH];
+    uint32_t depth;
+} prof;
+
+static void profiler_charge(uint32_t pc, uint64_t cycles) {
+    profiler_page_t *page = prof.pages[pc >> 8 & (PROFILER_PAGES - 1)];
+    if (!page) {
+        if (!(page = calloc(1, sizeof(profiler_page_t)))) {
+            return;
+        }
+        prof.pages[pc >> 8 & (PROFILER_PAGES - 1)] = page;
+    }
+    page->cycles[pc & (PROFILER_PAGE_SIZE - 1)] += cycles;
+    page->count[pc & (PROFILER_PAGE_SIZE - 1)]++;
+}
+
+static uint32_t profiler_hash(uint32_t site, uint32_t target) {
+    return site * 0x9E3779B1u ^ target * 0x85EBCA77u;
+}
+
+static void profiler_insert(uint32_t *slots, uint32_t mask, uint32_t index) {
+    const profiler_edge_t *edge = &prof.edges[index];
+    uint32_t slot = profiler_hash(edge->site, edge->target) & mask;
+    while (slots[slot]) {
+        slot = (slot + 1) & mask;
+    }
+    slots[slot] = index + 1;
+}
+
+/* Keeps the hash at most half full, with room for as many edges */
+static bool profiler_grow(void) {
+    uint32_t size = prof.slots ? (prof.slot_mask + 1) * 2 : 1024;
+    profiler_edge_t *edges;
+    uint32_t *slots;
+    uint32_t i;
+
+    if (!(edges = realloc(prof.edges, size / 2 * sizeof(profiler_edge_t)))) {
+        return false;
+    }
+    prof.edges = edges;
+    if (!(slots = calloc(size, sizeof(uint32_t)))) {
+        return false;
+    }
+    for (i = 0; i < prof.edge_count; i++) {
+        profiler_insert(slots, size - 1, i);
+    }
+    free(prof.slots);
+    prof.slots = slots;
+    prof.slot_mask = size - 1;
+    return true;
+}
+
+static bool profiler_edge(uint32_t site, uint32_t target, uint32_t *index) {
+    profiler_edge_t *edge;
+    uint32_t slot, i;
+
+    if ((!prof.slots || prof.edge_count >= (prof.slot_mask + 1) / 2) && !profiler_grow()) {
+        return false;
+    }
+    for (slot = profiler_hash(site, target) & prof.slot_mask; (i = prof.slots[slot]); slot = (slot + 1) & prof.slot_mask) {
+        edge = &prof.edges[i - 1];
+        if (edge->site == site && edge->target == target) {
+            *index = i - 1;
+            return true;
+        }
+    }
+    edge = &prof.edges[prof.edge_count];
+    memset(edge, 0, sizeof(profiler_edge_t));
+    edge->site = site;
+    edge->target = target;
+    prof.slots[slot] = ++prof.edge_count;
+    *index = prof.edge_count - 1;
+    return true;
+}
+
+static uint32_t profiler_sp(bool stack) {
+    return stack ? cpu.registers.SPL & 0xFFFFFF : cpu.registers.SPS;
+}
+
+void profiler_instruction(uint32_t pc) {
+    uint64_t now = sched_total_cycles();
+    if (prof.started) {
+        profiler_charge(profiler.pc, now > profiler.last ? now - profiler.last : 0);
+    }
+    prof.started = true;
+    prof.instructions++;
+    profiler.pc = pc;
+    profiler.last = now;
+}
+
+void profiler_sample(void) {
+    uint64_t now = sched_total_cycles();
+    uint64_t elapsed = now > profiler.last ? now - profiler.last : 0;
+    uint32_t i;
+
+    profiler_charge(profiler.pc, elapsed);
+    for (i = 0; i < prof.depth; i++) {
+        profiler_edge_t *edge = &prof.edges[prof.frames[i].edge];
+        edge->cycles += elapsed;
+        edge->count++;
+    }
+    profiler.last = now;
+    profiler.next_sample = now + profiler.interval;
+}
+
+void profiler_call(bool stack) {
+    profiler_frame_t *frame;
+    uint32_t edge;
+
+    if (prof.depth == PROFILER_DEPTH || !profiler_edge(profiler.pc, cpu.registers.PC, &edge)) {
+        return;
+    }
+    prof.edges[edge].calls++;
+    frame = &prof.frames[prof.depth++];
+    frame->edge = edge;
+    frame->sp = profiler_sp(stack);
+    frame->stack = stack;
+    frame->cycles = sched_total_cycles();
+    frame->count = prof.instructions;
+}
+
+/* Anything called since the stack was last this high has returned, whether or not it did so itself */
+void profiler_return(void) {
+    uint64_t now = sched_total_cycles();
+    while (prof.depth) {
+        profiler_frame_t *frame = &prof.frames[prof.depth - 1];
+        if (profiler_sp(frame->stack) <= frame->sp) {
+            break;
+        }
+        if (profiler.mode == PROFILER_EXACT) {
+            profiler_edge_t *edge = &prof.edges[frame->edge];
+            edge->cycles += now > frame->cycles ? now - frame->cycles : 0;
+            edge->count += prof.instructions - frame->count;
+        }
+        prof.depth--;
+    }
+}
+
+void profiler_free(void) {
+    uint32_t i;
+    profiler.mode = PROFILER_OFF;
+    debug_hook_set(DBG_HOOK_PROFILER, false);
+    for (i = 0; i < PROFILER_PAGES; i++) {
+        free(prof.pages[i]);
+        prof.pages[i] = NULL;
+    }
+    free(prof.edges);
+    free(prof.slots);
+    prof.edges = NULL;
+    prof.slots = NULL;
+    prof.edge_count = prof.slot_mask = prof.depth = 0;
+    prof.instructions = 0;
+    prof.started = false;
+    prof.mode = PROFILER_OFF;
+}
+
+void profiler_start(profiler_mode_t mode, uint32_t interval) {
+    uint64_t now = sched_total_cycles();
+
+    profiler_free();
+    prof.mode = mode;
+    profiler.pc = cpu.registers.PC;
+    profiler.last = now;
+    profiler.interval = interval ? interval : 1;
+    profiler.next_sample = now + profiler.interval;
+    profiler.mode = mode;
+    debug_hook_set(DBG_HOOK_PROFILER, mode != PROFILER_OFF);
+
+    /* The scheduler only brings the first sample forward once its next event comes */
+    if (mode == PROFILER_SAMPLE && cpu.next > cpu.cycles + profiler.interval) {
+        cpu.next = cpu.cycles + profiler.interval;
+    }
+}
+
+void profiler_stop(void) {
+    profiler.mode = PROFILER_OFF;
+    debug_hook_set(DBG_HOOK_PROFILER, false);
+}
+
+static int profiler_address_compare(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static int profiler_edge_compare(const void *a, const void *b) {
+    const profiler_edge_t *x = &prof.edges[*(const uint32_t*)a], *y = &prof.edges[*(const uint32_t*)b];
+    if (x->site != y->site) {
+        return (x->site > y->site) - (x->site < y->site);
+    }
+    return (x->target > y->target) - (x->target < y->target);
+}
+
+/*
+ * Functions start at the reset vector, wherever something was called, and at the functions found by analysis.
+ * Everything else belongs to the closest one below it.
+ */
+static uint32_t *profiler_functions(uint32_t *count) {
+    uint32_t total = 1 + prof.edge_count + analysis.function_count;
+    uint32_t *entries = malloc(total * sizeof(uint32_t));
+    uint32_t i, n = 0;
+
+    if (!entries) {
+        return NULL;
+    }
+    entries[n++] = 0;
+    for (i = 0; i < prof.edge_count; i++) {
+        entries[n++] = prof.edges[i].target;
+    }
+    for (i = 0; i < analysis.function_count; i++) {
+        entries[n++] = analysis.functions[i].start;
+    }
+    qsort(entries, n, sizeof(uint32_t), profiler_address_compare);
+    for (total = i = 1; i < n; i++) {
+        if (entries[i] != entries[total - 1]) {
+            entries[total++] = entries[i];
+        }
+    }
+    *count = total;
+    return entries;
+}
+
+static uint32_t profiler_function(const uint32_t *entries, uint32_t count, uint32_t address) {
+    uint32_t low = 0, high = count;
+    while (high - low > 1) {
+        uint32_t mid = low + (high - low) / 2;
+        if (entries[mid] <= address) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return entries[low];
+}
+
+static const char *profiler_name(uint32_t address) {
+    static char buffer[256];
+    const char *name = symbols_name(address);
+    uint32_t offset;
+
+    if (name) {
+        return name;
+    }
+    if ((name = symbols_find(address, PROFILER_SYMBOL_RANGE, &offset))) {
+        snprintf(buffer, sizeof(buffer), "%s+$%02X", name, offset);
+    } else {
+        snprintf(buffer, sizeof(buffer), "sub_%06X", address);
+    }
+    return buffer;
+}
+
+typedef struct {
+    FILE *file;
+    const uint32_t *entries;
+    uint32_t entry_count;
+    uint32_t current;               /* Function being written */
+    const uint32_t *order;          /* Edges by call site */
+    const uint64_t *open;           /* What calls that haven't returned add to their edge */
+    uint32_t next;                  /* Next edge to write */
+} profiler_writer_t;
+
+static void profiler_enter(profiler_writer_t *w, uint32_t address) {
+    uint32_t function = profiler_function(w->entries, w->entry_count, address);
+    if (w->current != function) {
+        fprintf(w->file, "\nfn=%s\n", profiler_name(function));
+        w->current = function;
+    }
+}
+
+/* Write every call made from below end that hasn't been written yet */
+static void profiler_write_calls(profiler_writer_t *w, uint32_t end) {
+    for (; w->next < prof.edge_count && prof.edges[w->order[w->next]].site < end; w->next++) {
+        uint32_t index = w->order[w->next];
+        const profiler_edge_t *edge = &prof.edges[index];
+        profiler_enter(w, edge->site);
+        fprintf(w->file, "cfn=%s\n", profiler_name(profiler_function(w->entries, w->entry_count, edge->target)));
+        fprintf(w->file, "calls=%llu 0x%06X\n0x%06X %llu %llu\n", (unsigned long long)edge->calls, edge->target, edge->site,
+                (unsigned long long)(edge->cycles + w->open[index * 2]),
+                (unsigned long long)(edge->count + w->open[index * 2 + 1]));
+    }
+}
+
+bool profiler_export(const char *path) {
+    profiler_writer_t w;
+    uint32_t *entries, *order = NULL;
+    uint64_t *open = NULL;
+    uint64_t total_cycles = 0, total_count = 0;
+    uint64_t now = sched_total_cycles();
+    uint32_t entry_count, i, page;
+    bool ok;
+
+    if (!(entries = profiler_functions(&entry_count))) {
+        return false;
+    }
+    if (!(order = malloc((prof.edge_count + 1) * sizeof(uint32_t))) ||
+        !(open = calloc(prof.edge_count * 2 + 1, sizeof(uint64_t)))) {
+        free(entries);
+        free(order);
+        return false;
+    }
+    for (i = 0; i < prof.edge_count; i++) {
+        order[i] = i;
+    }
+    qsort(order, prof.edge_count, sizeof(uint32_t), profiler_edge_compare);
+
+    /* Calls that haven't returned yet count up to now in exact mode */
+    if (prof.mode == PROFILER_EXACT) {
+        for (i = 0; i < prof.depth; i++) {
+            const profiler_frame_t *frame = &prof.frames[i];
+            open[frame->edge * 2] += now > frame->cycles ? now - frame->cycles : 0;
+            open[frame->edge * 2 + 1] += prof.instructions - frame->count;
+        }
+    }
+
+    for (page = 0; page < PROFILER_PAGES; page++) {
+        if (prof.pages[page]) {
+            for (i = 0; i < PROFILER_PAGE_SIZE; i++) {
+                total_cycles += prof.pages[page]->cycles[i];
+                total_count += prof.pages[page]->count[i];
+            }
+        }
+    }
+
+    if (!(w.file = fopen_utf8(path, "w"))) {
+        free(entries);
+        free(order);
+        free(open);
+        return false;
+    }
+    w.entries = entries;
+    w.entry_count = entry_count;
+    w.current = ~0u;
+    w.order = order;
+    w.open = open;
+    w.next = 0;
+
+    fprintf(w.file, "# callgrind format\nversion: 1\ncreator: CEmu\npositions: instr\n");
+    fprintf(w.file, "events: Cycles %s\n", prof.mode == PROFILER_EXACT ? "Instructions" : "Samples");
+    fprintf(w.file, "summary: %llu %llu\n", (unsigned long long)total_cycles, (unsigned long long)total_count);
+
+    /* Costs and calls go out in address order, so each function is written in one piece */
+    for (page = 0; page < PROFILER_PAGES; page++) {
+        const profiler_page_t *costs = prof.pages[page];
+        if (!costs) {
+            continue;
+        }
+        for (i = 0; i < PROFILER_PAGE_SIZE; i++) {
+            uint32_t address = page * PROFILER_PAGE_SIZE + i;
+            if (costs->count[i] || costs->cycles[i]) {
+                profiler_write_calls(&w, address);
+                profiler_enter(&w, address);
+                fprintf(w.file, "0x%06X %llu %llu\n", address,
+                        (unsigned long long)costs->cycles[i], (unsigned long long)costs->count[i]);
+            }
+        }
+    }
+    profiler_write_calls(&w, ~0u);
+
+    ok = !ferror(w.file);
+    ok = !fclose(w.file) && ok;
+    free(entries);
+    free(order);
+    free(open);
+    if (!ok) {
+        remove(path);
+    }
+    return ok;
+}
+
+#endif
@@ -0,0 +1,53 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Where the guest spends its cycles. Exact mode charges every instruction with the cycles it took, sampling mode
+ * charges the instruction that just ran with everything since the last sample, once every interval cycles. Both
+ * follow calls on a shadow stack so calls can be given inclusive costs, and write callgrind files.
+ */
+typedef enum {
+    PROFILER_OFF,
+    PROFILER_EXACT,
+    PROFILER_SAMPLE
+} profiler_mode_t;
+
+typedef struct {
+    uint32_t mode;              /* profiler_mode_t */
+    uint32_t pc;                /* Start of the instruction running now */
+    uint64_t last;              /* When it started in exact mode, or the last sample */
+    uint64_t next_sample;       /* In sched_total_cycles() */
+    uint32_t interval;
+} profiler_t;
+
+extern profiler_t profiler;
+
+/* Forgets the last results; sampling mode takes a sample every interval cycles */
+void profiler_start(profiler_mode_t mode, uint32_t interval);
+void profiler_stop(void);
+void profiler_free(void);
+/* Write the results in callgrind format, naming functions after loaded symbols; false if it couldn't be written */
+bool profiler_export(const char *path);
+
+/* Hooks */
+void profiler_instruction(uint32_t pc);     /* Exact mode, before each instruction */
+void profiler_sample(void);                 /* Once sched_total_cycles() reaches next_sample */
+void profiler_call(bool stack);             /* After a call, with the stack it pushed onto: SPL or SPS */
+void profiler_return(void);                 /* After a return */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
@@ -2,21 +2,24 @@
 
 #include "debug.h"
 #include "stepping.h"
-#include "disasm.h"
+#include "opcodes.h"
 #include "../mem.h"
 #include "../emu.h"
 #include "../asic.h"
 
+static uint8_t debug_step_read(void *context, uint32_t address) {
+    (void)context;
+    return debug_read_byte(address);
+}
+
 void debug_set_step_next(void) {
+    opcode_inst_t inst;
     debug_clear_step_over();
     debugger.stepOverRequested = false;
-    disasm.base_address = cpu.registers.PC;
-    //fprintf(stderr, "[setDebugStepNextMode] disasm.base_address=0x%08x\n", disasm.base_address);
-    disasm.adl = cpu.ADL;
-    disassembleInstruction();
+    opcode_decode(&inst, cpu.registers.PC, cpu.ADL, debug_step_read, NULL);
     debugger.stepOverFirstStep = true;
     debugger.stepOverCall = false;
-    debugger.stepOverInstrEnd = disasm.new_address;
+    debugger.stepOverInstrEnd = cpu.registers.PC + inst.size;
     debugger.data.block[debugger.stepOverInstrEnd] |= DBG_STEP_OVER_BREAKPOINT;
     debugger.stepOverMode = cpu.ADL;
     debugger.stepOutSPL = 0;
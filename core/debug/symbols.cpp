@@ -0,0 +1,198 @@
+#ifdef DEBUG_SUPPORT
+
+#include <algorithm>
+#include <string.h>
+
+#include "symbols.h"
+#include "disasm.h"
+#include "../mem.h"
+#include "../os/os.h"
+
+symbol_table_t symbols;
+
+static bool symbols_less(const symbol_t &a, const symbol_t &b) {
+    return a.address < b.address;
+}
+
+static bool symbols_space(char c) {
+    return c == ' ' || c == '\t';
+}
+
+static bool symbols_word(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static int symbols_hex(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+static void symbols_add(std::vector<symbol_t> &list, uint32_t address, const char *name, size_t length) {
+    symbol_t symbol;
+    symbol.address = address;
+    symbol.name = static_cast<uint32_t>(symbols.names.size());
+    symbols.names.append(name, length);
+    symbols.names.push_back('\0');
+    list.push_back(symbol);
+}
+
+/*
+ * Matches "name = $1234", "name equ 1234h" and "name .equ $1234" with an optional comment, which is all the
+ * include and symbol files the assemblers write need. Values have at least four hex digits so that plain
+ * constants are left out. Returns false if the line is anything else.
+ */
+static bool symbols_parse_line(const char *p, const char *end, const char **name, size_t *length, uint32_t *value) {
+    unsigned int digits = 0;
+    bool spaced;
+
+    while (p < end && symbols_space(*p)) {
+        p++;
+    }
+    if (p == end || !symbols_word(*p) || (*p >= '0' && *p <= '9')) {
+        return false;
+    }
+    *name = p;
+    while (p < end && symbols_word(*p)) {
+        p++;
+    }
+    *length = static_cast<size_t>(p - *name);
+
+    spaced = p < end && symbols_space(*p);
+    while (p < end && symbols_space(*p)) {
+        p++;
+    }
+    if (p < end && *p == '=') {
+        p++;
+    } else if (spaced) {
+        p += p < end && *p == '.';
+        if (end - p < 3 || (p[0] | 0x20) != 'e' || (p[1] | 0x20) != 'q' || (p[2] | 0x20) != 'u') {
+            return false;
+        }
+        p += 3;
+        if (p < end && *p >= '0' && *p <= '9') {
+            return false;
+        }
+    } else {
+        return false;
+    }
+    while (p < end && symbols_space(*p)) {
+        p++;
+    }
+
+    *value = 0;
+    if (p < end && *p == '$') {
+        for (p++; p < end && symbols_hex(*p) >= 0; p++, digits++) {
+            *value = *value << 4 | static_cast<uint32_t>(symbols_hex(*p));
+        }
+    } else if (p < end && *p >= '0' && *p <= '9') {
+        for (; p < end && symbols_hex(*p) >= 0; p++, digits++) {
+            *value = *value << 4 | static_cast<uint32_t>(symbols_hex(*p));
+        }
+        if (p == end || (*p | 0x20) != 'h') {
+            return false;
+        }
+        p++;
+    }
+    if (digits < 4 || digits > 8) {
+        return false;
+    }
+
+    while (p < end && symbols_space(*p)) {
+        p++;
+    }
+    return p == end || *p == ';';
+}
+
+/* Sorts the new symbols after the old ones, keeping the order they came in at the same address */
+static void symbols_merge(std::vector<symbol_t> &list) {
+    size_t count = symbols.symbols.size();
+    std::stable_sort(list.begin(), list.end(), symbols_less);
+    symbols.symbols.insert(symbols.symbols.end(), list.begin(), list.end());
+    std::inplace_merge(symbols.symbols.begin(), symbols.symbols.begin() + count, symbols.symbols.end(), symbols_less);
+}
+
+bool symbols_load(const char *path) {
+    os_file_map_t *map = os_file_map(path);
+    std::vector<symbol_t> list, jumps;
+    const char *p, *end, *eol, *name;
+    size_t length;
+    uint32_t value;
+
+    if (!map) {
+        return false;
+    }
+
+    p = static_cast<const char *>(os_file_map_data(map));
+    end = p + os_file_map_size(map);
+    for (; p < end; p = eol + 1) {
+        eol = static_cast<const char *>(memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!eol) {
+            eol = end;
+        }
+        if (symbols_parse_line(p, eol > p && eol[-1] == '\r' ? eol - 1 : eol, &name, &length, &value)) {
+            symbols_add(list, value, name, length);
+        }
+    }
+    os_file_unmap(map);
+
+    symbols_merge(list);
+
+    /* OS routines are called through a jump table, so name what each entry jumps to after it as well */
+    for (const symbol_t &symbol : list) {
+        uint8_t *ptr;
+        if (symbols_name(symbol.address) != &symbols.names[symbol.name]) {
+            continue;
+        }
+        ptr = phys_mem_ptr(symbol.address - 4, 9);
+        if (ptr && ptr[4] == 0xC3 && (ptr[0] == 0xC3 || ptr[8] == 0xC3)) {
+            uint32_t target = ptr[5] | ptr[6] << 8 | ptr[7] << 16;
+            if (phys_mem_ptr(target, 1) && !symbols_name(target)) {
+                std::string alias = "_" + std::string(&symbols.names[symbol.name]);
+                symbols_add(jumps, target, alias.data(), alias.size());
+            }
+        }
+    }
+    symbols_merge(jumps);
+
+    disasm_cache_flush();
+    return true;
+}
+
+void symbols_clear(void) {
+    symbols.symbols.clear();
+    symbols.names.clear();
+    disasm_cache_flush();
+}
+
+const char *symbols_name(uint32_t address) {
+    symbol_t key = { address, 0 };
+    std::vector<symbol_t>::const_iterator it =
+        std::lower_bound(symbols.symbols.begin(), symbols.symbols.end(), key, symbols_less);
+    if (it == symbols.symbols.end() || it->address != address) {
+        return NULL;
+    }
+    return &symbols.names[it->name];
+}
+
+const char *symbols_find(uint32_t address, uint32_t range, uint32_t *offset) {
+    symbol_t key = { address, 0 };
+    std::vector<symbol_t>::const_iterator it =
+        std::upper_bound(symbols.symbols.begin(), symbols.symbols.end(), key, symbols_less);
+    if (it == symbols.symbols.begin()) {
+        return NULL;
+    }
+    --it;
+    if (address - it->address > range) {
+        return NULL;
+    }
+    *offset = address - it->address;
+    return symbols_name(it->address);
+}
+
+#endif
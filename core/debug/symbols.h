@@ -0,0 +1,45 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef SYMBOLS_H
+#define SYMBOLS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Loads the equates of an assembler include or symbol file, adding to the ones already loaded; false if it couldn't be read */
+bool symbols_load(const char *path);
+void symbols_clear(void);
+
+/* The first symbol loaded for exactly this address, or NULL */
+const char *symbols_name(uint32_t address);
+
+/* The closest symbol at or below the address and how far past it the address is, or NULL if there is none within range */
+const char *symbols_find(uint32_t address, uint32_t range, uint32_t *offset);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+#include <vector>
+
+typedef struct {
+    uint32_t address;
+    uint32_t name;                  /* offset of the NUL terminated name in names */
+} symbol_t;
+
+typedef struct {
+    std::vector<symbol_t> symbols;  /* sorted by address, then by the order they were loaded in */
+    std::string names;
+} symbol_table_t;
+
+extern symbol_table_t symbols;
+
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,246 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "timeline.h"
+#include "../cpu.h"
+#include "../perf.h"
+#include "../schedule.h"
+#include "../interrupt.h"
+#include "../os/os.h"
+
+#define TIMELINE_SOURCES 22     /* Bits in the interrupt status */
+
+timeline_t timeline;
+
+typedef struct {
+    uint64_t cycle;
+    uint64_t emu_ns;
+    uint64_t host_ns;
+    uint32_t host_duration;                 /* In ns, of events and throttle waits */
+    uint32_t arg;
+    uint8_t kind;
+} timeline_record_t;
+
+typedef struct {
+    uint32_t sp;                            /* Before the return address was pushed */
+    bool stack;                             /* SPL rather than SPS */
+} timeline_frame_t;
+
+static struct {
+    timeline_record_t *records;
+    uint32_t capacity;
+    uint32_t head;                          /* Written next */
+    uint64_t total;
+    uint64_t last_cycle;
+    uint64_t emu_ns;                        /* Emulated time at last_cycle, at the clock rates as they were */
+    uint64_t emu_rest;                      /* What didn't make a whole ns */
+    timeline_frame_t frames[TIMELINE_NESTED];
+    uint32_t depth;
+} tl;
+
+/* Bumped whenever the records are reallocated, so a handle from before can't reach into the new ones */
+static uint32_t timeline_generation;
+
+static const char *const timeline_interrupt_names[TIMELINE_SOURCES] = {
+    "on", "timer1", "timer2", "timer3", "ostimer", NULL, NULL, NULL, NULL, NULL, "keypad", "lcd", "rtc",
+    NULL, NULL, "power"
+};
+
+static uint32_t timeline_record(timeline_kind_t kind, uint32_t arg) {
+    uint32_t index = tl.head;
+    timeline_record_t *record = &tl.records[index];
+    uint64_t now = sched_total_cycles();
+
+    /* The CPU can change speed, so emulated time goes on at the rate between each record and the next */
+    if (now > tl.last_cycle) {
+        uint64_t ns = (now - tl.last_cycle) * 1000000000 + tl.emu_rest;
+        tl.emu_ns += ns / sched.clockRates[CLOCK_CPU];
+        tl.emu_rest = ns % sched.clockRates[CLOCK_CPU];
+    }
+    tl.last_cycle = now;
+
+    record->cycle = now;
+    record->emu_ns = tl.emu_ns;
+    record->host_ns = os_time_ns();
+    record->host_duration = 0;
+    record->arg = arg;
+    record->kind = (uint8_t)kind;
+    if (++tl.head == tl.capacity) {
+        tl.head = 0;
+    }
+    tl.total++;
+    return index;
+}
+
+timeline_handle_t timeline_begin(timeline_kind_t kind, uint32_t arg) {
+    timeline_handle_t handle;
+    handle.index = timeline_record(kind, arg);
+    handle.generation = timeline_generation;
+    return handle;
+}
+
+void timeline_end(timeline_handle_t handle) {
+    timeline_record_t *record;
+    uint64_t duration;
+
+    if (handle.generation != timeline_generation || handle.index >= tl.capacity) {
+        return;
+    }
+    record = &tl.records[handle.index];
+    duration = os_time_ns() - record->host_ns;
+    record->host_duration = duration > UINT32_MAX ? UINT32_MAX : (uint32_t)duration;
+}
+
+void timeline_interrupt(uint32_t sources) {
+    timeline_frame_t *frame;
+    timeline_record(TIMELINE_INTERRUPT, sources);
+    /* A handler that never returns would stay open forever, so the oldest goes to make room */
+    if (tl.depth == TIMELINE_NESTED) {
+        memmove(tl.frames, tl.frames + 1, (TIMELINE_NESTED - 1) * sizeof(timeline_frame_t));
+        tl.depth--;
+    }
+    frame = &tl.frames[tl.depth++];
+    frame->stack = cpu.MADL;
+    frame->sp = frame->stack ? cpu.registers.SPL : cpu.registers.SPS;
+}
+
+/* The handler is done once the stack is back to where it was when the interrupt was taken */
+void timeline_return(void) {
+    while (tl.depth) {
+        const timeline_frame_t *frame = &tl.frames[tl.depth - 1];
+        if ((frame->stack ? cpu.registers.SPL : cpu.registers.SPS) < frame->sp) {
+            break;
+        }
+        tl.depth--;
+        timeline_record(TIMELINE_INTERRUPT_RETURN, 0);
+    }
+}
+
+bool timeline_start(uint32_t count) {
+    timeline_stop();
+    free(tl.records);
+    memset(&tl, 0, sizeof(tl));
+    if (!++timeline_generation) {
+        timeline_generation = 1;
+    }
+    if (!count || !(tl.records = malloc((size_t)count * sizeof(timeline_record_t)))) {
+        return false;
+    }
+    tl.capacity = count;
+    tl.last_cycle = sched_total_cycles();
+    timeline.active = true;
+    return true;
+}
+
+void timeline_stop(void) {
+    timeline.active = false;
+}
+
+void timeline_free(void) {
+    timeline_stop();
+    free(tl.records);
+    memset(&tl, 0, sizeof(tl));
+    if (!++timeline_generation) {
+        timeline_generation = 1;
+    }
+}
+
+uint32_t timeline_count(void) {
+    return tl.total < tl.capacity ? (uint32_t)tl.total : tl.capacity;
+}
+
+static void timeline_sources(char *out, size_t size, uint32_t sources) {
+    size_t used = 0;
+    uint32_t i;
+
+    *out = '\0';
+    if (sources & TIMELINE_NMI) {
+        snprintf(out, size, "nmi");
+        return;
+    }
+    for (i = 0; i < TIMELINE_SOURCES && used < size; i++) {
+        if (sources >> i & 1) {
+            if (timeline_interrupt_names[i]) {
+                used += snprintf(out + used, size - used, "%s%s", used ? " " : "", timeline_interrupt_names[i]);
+            } else {
+                used += snprintf(out + used, size - used, "%sbit%u", used ? " " : "", i);
+            }
+        }
+    }
+}
+
+bool timeline_export(const char *path) {
+    uint32_t count = timeline_count(), i;
+    uint64_t emu_base = 0, host_base = 0;
+    char sources[128];
+    FILE *file;
+    bool ok;
+
+    if (!(file = fopen_utf8(path, "w"))) {
+        return false;
+    }
+
+    /* Times start from the first record held, in the microseconds the format wants */
+    if (count) {
+        const timeline_record_t *first = &tl.records[(tl.head + tl.capacity - count) % tl.capacity];
+        emu_base = first->emu_ns;
+        host_base = first->host_ns;
+    }
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+          "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Emulated time\"}},\n"
+          "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"Host time\"}},\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Scheduler\"}},\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"Interrupts\"}},\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":1,\"args\":{\"name\":\"Scheduler\"}},\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":2,\"args\":{\"name\":\"Throttle\"}},\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":2,\"tid\":3,\"args\":{\"name\":\"Interrupts\"}}", file);
+
+    for (i = 0; i < count; i++) {
+        const timeline_record_t *record = &tl.records[(tl.head + tl.capacity - count + i) % tl.capacity];
+        double emu = (record->emu_ns - emu_base) / 1e3;
+        double host = (record->host_ns - host_base) / 1e3;
+        unsigned long long cycle = (unsigned long long)record->cycle;
+
+        switch (record->kind) {
+            case TIMELINE_EVENT: {
+                const char *name = record->arg < SCHED_NUM_ITEMS ? perf_event_names[record->arg] : "event";
+                fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"event\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":1,"
+                              "\"ts\":%.3f,\"args\":{\"cycle\":%llu,\"host_us\":%.3f}}", name, emu, cycle, host);
+                fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"event\",\"ph\":\"X\",\"pid\":2,\"tid\":1,"
+                              "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"cycle\":%llu,\"emulated_us\":%.3f}}",
+                        name, host, record->host_duration / 1e3, cycle, emu);
+                break;
+            }
+            case TIMELINE_THROTTLE:
+                fprintf(file, ",\n{\"name\":\"throttle wait\",\"cat\":\"throttle\",\"ph\":\"X\",\"pid\":2,\"tid\":2,"
+                              "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"cycle\":%llu,\"emulated_us\":%.3f}}",
+                        host, record->host_duration / 1e3, cycle, emu);
+                break;
+            case TIMELINE_INTERRUPT:
+                timeline_sources(sources, sizeof(sources), record->arg);
+                fprintf(file, ",\n{\"name\":\"interrupt\",\"cat\":\"interrupt\",\"ph\":\"B\",\"pid\":1,\"tid\":2,"
+                              "\"ts\":%.3f,\"args\":{\"cycle\":%llu,\"host_us\":%.3f,\"sources\":\"%s\"}}",
+                        emu, cycle, host, sources);
+                fprintf(file, ",\n{\"name\":\"interrupt\",\"cat\":\"interrupt\",\"ph\":\"i\",\"s\":\"t\",\"pid\":2,\"tid\":3,"
+                              "\"ts\":%.3f,\"args\":{\"cycle\":%llu,\"emulated_us\":%.3f,\"sources\":\"%s\"}}",
+                        host, cycle, emu, sources);
+                break;
+            case TIMELINE_INTERRUPT_RETURN:
+                fprintf(file, ",\n{\"name\":\"interrupt\",\"cat\":\"interrupt\",\"ph\":\"E\",\"pid\":1,\"tid\":2,"
+                              "\"ts\":%.3f,\"args\":{\"cycle\":%llu,\"host_us\":%.3f}}", emu, cycle, host);
+                break;
+            default:
+                break;
+        }
+    }
+    fputs("\n]}\n", file);
+
+    ok = !ferror(file);
+    ok = !fclose(file) && ok;
+    return ok;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * When scheduler events fire, the throttle waits and interrupts are taken and return, each with the emulated
+ * and the host time, kept in a ring buffer. It is exported in the Chrome trace event format, which Perfetto and
+ * chrome://tracing show as a timeline: once along emulated time to see jitter and interrupt latency, and once
+ * along host time to see what the emulator itself spends its time on.
+ */
+
+typedef enum {
+    TIMELINE_EVENT,             /* A scheduler event ran; arg is its sched_item_index */
+    TIMELINE_THROTTLE,          /* Waited to keep to the emulated speed */
+    TIMELINE_INTERRUPT,         /* Taken; arg is the interrupts pending and enabled, or TIMELINE_NMI */
+    TIMELINE_INTERRUPT_RETURN   /* The handler returned to where the interrupt was taken */
+} timeline_kind_t;
+
+#define TIMELINE_NMI    (1u << 31)
+#define TIMELINE_NESTED 16      /* Interrupts followed inside one another */
+
+typedef struct {
+    bool active;
+} timeline_t;
+
+/* A record left open by timeline_begin(); generation 0 for none */
+typedef struct {
+    uint32_t index;
+    uint32_t generation;
+} timeline_handle_t;
+
+extern timeline_t timeline;
+
+/* Keeps the last count records, with the interrupt nesting starting empty; false without the memory */
+bool timeline_start(uint32_t count);
+void timeline_stop(void);
+void timeline_free(void);
+/* Records held now */
+uint32_t timeline_count(void);
+/* Write the records held as Chrome trace JSON; false if it couldn't be written */
+bool timeline_export(const char *path);
+
+/* Hooks */
+timeline_handle_t timeline_begin(timeline_kind_t kind, uint32_t arg);   /* Before an event or the throttle wait */
+void timeline_end(timeline_handle_t handle);                            /* After it; ignored if restarted since */
+void timeline_interrupt(uint32_t sources);                              /* Before the interrupt pushes its return */
+void timeline_return(void);                                             /* After each return */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
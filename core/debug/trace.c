@@ -0,0 +1,271 @@
+#ifdef DEBUG_SUPPORT
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "trace.h"
+#include "../cpu.h"
+#include "../mem.h"
+#include "../emu.h"
+#include "../schedule.h"
+#include "../os/os.h"
+
+#define TRACE_PAGES      (0x1000000 / TRACE_PAGE_SIZE)
+#define TRACE_RECORD_MAX 96      /* An instruction and all that can follow it is 66 bytes at most */
+#define TRACE_NO_PC      0xFFFFFFFF
+#define TRACE_CODE_SIZE  8      /* Longest instruction that gets recorded as one, short of endless prefixes */
+
+trace_t trace;
+
+typedef struct {
+    uint64_t start;                         /* Cycle the first instruction started at */
+    uint32_t count;
+    uint32_t used;
+    uint8_t data[TRACE_CHUNK_SIZE];
+} trace_chunk_t;
+
+static struct {
+    trace_chunk_t *chunks;
+    uint32_t chunk_count;
+    uint32_t head;                          /* Being written */
+    uint32_t filled;
+    trace_chunk_t *chunk;                   /* The head, once there is one */
+    uint32_t last_pc;
+    uint64_t last_start;
+    uint32_t write_count;                   /* By the last instruction */
+    uint8_t pages[TRACE_PAGES / 8];         /* Pages code ran from */
+    uint32_t code_start;                    /* Last page marked, with room for an instruction at its end */
+    char *save_path;
+    unsigned int save_events;
+} tr;
+
+static uint8_t *trace_varint(uint8_t *out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = (uint8_t)value | 0x80;
+        value >>= 7;
+    }
+    *out++ = (uint8_t)value;
+    return out;
+}
+
+static void trace_next_chunk(uint64_t start) {
+    tr.head = (tr.head + 1) % tr.chunk_count;
+    if (tr.filled < tr.chunk_count) {
+        tr.filled++;
+    }
+    tr.chunk = &tr.chunks[tr.head];
+    tr.chunk->start = start;
+    tr.chunk->count = 0;
+    tr.chunk->used = 0;
+    tr.last_pc = TRACE_NO_PC;
+    tr.last_start = start;
+}
+
+static void trace_mark_code(uint32_t pc) {
+    uint32_t first = pc / TRACE_PAGE_SIZE;
+    uint32_t last = ((pc + TRACE_CODE_SIZE - 1) & 0xFFFFFF) / TRACE_PAGE_SIZE;
+    tr.pages[first >> 3] |= 1 << (first & 7);
+    tr.pages[last >> 3] |= 1 << (last & 7);
+    tr.code_start = pc & ~(TRACE_PAGE_SIZE - 1);
+}
+
+/* Everything the fast path in trace_instruction() doesn't cover */
+static uint8_t *trace_encode(uint8_t *out, uint8_t tag, uint32_t pc, uint64_t cycles) {
+    int32_t delta = (int32_t)(((pc - tr.last_pc) & 0xFFFFFF) << 8) >> 8;
+    uint8_t *first = out++;
+
+    if (tr.last_pc == TRACE_NO_PC || delta < -0x8000 || delta > 0x7FFF) {
+        tag |= TRACE_PC_LONG;
+        *out++ = (uint8_t)pc;
+        *out++ = (uint8_t)(pc >> 8);
+        *out++ = (uint8_t)(pc >> 16);
+    } else if (delta < -0x80 || delta > 0x7F) {
+        tag |= TRACE_PC_WORD;
+        *out++ = (uint8_t)delta;
+        *out++ = (uint8_t)(delta >> 8);
+    } else {
+        tag |= TRACE_PC_BYTE;
+        *out++ = (uint8_t)delta;
+    }
+    if (cycles < TRACE_CYCLES_MORE) {
+        tag |= (uint8_t)cycles;
+    } else {
+        tag |= TRACE_CYCLES_MORE;
+        out = trace_varint(out, cycles - TRACE_CYCLES_MORE);
+    }
+    *first = tag;
+    return out;
+}
+
+void trace_instruction(uint32_t pc) {
+    uint64_t now = sched_total_cycles();
+    uint64_t cycles = now > tr.last_start ? now - tr.last_start : 0;    /* A reset can take the cycles back */
+    uint32_t delta = pc - tr.last_pc + 0x80;
+    uint8_t tag = cpu.ADL ? TRACE_TAG_ADL : 0;
+    trace_chunk_t *chunk = tr.chunk;
+    uint8_t *out;
+
+    if (tr.write_count > TRACE_WRITES) {
+        out = chunk->data + chunk->used;
+        *out++ = TRACE_MARK_DROPPED;
+        chunk->used = trace_varint(out, tr.write_count - TRACE_WRITES) - chunk->data;
+    }
+    tr.write_count = 0;
+
+    /* Start the next chunk over the oldest one once this one could run out */
+    if (!chunk || chunk->used > TRACE_CHUNK_SIZE - TRACE_RECORD_MAX) {
+        trace_next_chunk(now);
+        chunk = tr.chunk;
+        cycles = 0;
+        delta = ~0u;
+    }
+
+    /* Most instructions are quick and close to the last one */
+    out = chunk->data + chunk->used;
+    if (delta < 0x100 && cycles < TRACE_CYCLES_MORE) {
+        out[0] = tag | TRACE_PC_BYTE | (uint8_t)cycles;
+        out[1] = (uint8_t)(delta - 0x80);
+        out += 2;
+    } else {
+        out = trace_encode(out, tag, pc, cycles);
+    }
+    chunk->used = out - chunk->data;
+    chunk->count++;
+    tr.last_pc = pc;
+    tr.last_start = now;
+
+    if (pc - tr.code_start > TRACE_PAGE_SIZE - TRACE_CODE_SIZE) {
+        trace_mark_code(pc);
+    }
+}
+
+void trace_interrupt(void) {
+    if (tr.chunk) {
+        tr.chunk->data[tr.chunk->used++] = TRACE_MARK_INTERRUPT;
+    }
+}
+
+void trace_write(uint32_t address, uint8_t value) {
+    if (tr.chunk && tr.write_count++ < TRACE_WRITES) {
+        uint8_t *out = tr.chunk->data + tr.chunk->used;
+        out[0] = TRACE_MARK_WRITE;
+        out[1] = (uint8_t)address;
+        out[2] = (uint8_t)(address >> 8);
+        out[3] = (uint8_t)(address >> 16);
+        out[4] = value;
+        tr.chunk->used += 5;
+    }
+}
+
+void trace_event(unsigned int event) {
+    if ((tr.save_events & event) && tr.save_path) {
+        if (trace_save(tr.save_path)) {
+            gui_console_printf("[CEmu] Saved the instruction trace to %s\n", tr.save_path);
+        } else {
+            gui_console_err_printf("[CEmu] Couldn't save the instruction trace to %s\n", tr.save_path);
+        }
+    }
+}
+
+bool trace_start(uint32_t size, bool writes) {
+    uint32_t count = size / sizeof(trace_chunk_t);
+
+    trace_stop();
+    free(tr.chunks);
+    if (count < 2) {
+        count = 2;
+    }
+    if (!(tr.chunks = malloc(count * sizeof(trace_chunk_t)))) {
+        tr.chunk_count = tr.filled = 0;
+        tr.chunk = NULL;
+        return false;
+    }
+    tr.chunk_count = count;
+    tr.head = count - 1;
+    tr.filled = 0;
+    tr.chunk = NULL;
+    tr.write_count = 0;
+    memset(tr.pages, 0, sizeof(tr.pages));
+    tr.code_start = TRACE_NO_PC;
+    trace.writes = writes;
+    trace.active = true;
+    debug_hook_set(DBG_HOOK_TRACE, true);
+    return true;
+}
+
+void trace_stop(void) {
+    trace.active = false;
+    debug_hook_set(DBG_HOOK_TRACE, false);
+}
+
+void trace_free(void) {
+    trace_stop();
+    free(tr.chunks);
+    free(tr.save_path);
+    memset(&tr, 0, sizeof(tr));
+}
+
+uint64_t trace_instructions(void) {
+    uint64_t count = 0;
+    uint32_t i;
+    for (i = 0; i < tr.filled; i++) {
+        count += tr.chunks[i].count;
+    }
+    return count;
+}
+
+void trace_save_on(const char *path, unsigned int events) {
+    free(tr.save_path);
+    tr.save_path = path && events ? strdup(path) : NULL;
+    tr.save_events = tr.save_path ? events : 0;
+}
+
+static void trace_put32(FILE *file, uint32_t value) {
+    uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+static void trace_put64(FILE *file, uint64_t value) {
+    trace_put32(file, (uint32_t)value);
+    trace_put32(file, (uint32_t)(value >> 32));
+}
+
+bool trace_save(const char *path) {
+    static const uint8_t unmapped[TRACE_PAGE_SIZE];
+    uint32_t i, pages = 0;
+    FILE *file;
+    bool ok;
+
+    if (!(file = fopen_utf8(path, "wb"))) {
+        return false;
+    }
+
+    fwrite(TRACE_MAGIC, 1, TRACE_MAGIC_SIZE, file);
+    trace_put32(file, tr.filled);
+    for (i = 0; i < tr.filled; i++) {
+        const trace_chunk_t *chunk = &tr.chunks[(tr.head + tr.chunk_count - tr.filled + 1 + i) % tr.chunk_count];
+        trace_put64(file, chunk->start);
+        trace_put32(file, chunk->count);
+        trace_put32(file, chunk->used);
+        fwrite(chunk->data, 1, chunk->used, file);
+    }
+
+    for (i = 0; i < TRACE_PAGES; i++) {
+        pages += tr.pages[i >> 3] >> (i & 7) & 1;
+    }
+    trace_put32(file, pages);
+    for (i = 0; i < TRACE_PAGES; i++) {
+        if (tr.pages[i >> 3] >> (i & 7) & 1) {
+            const uint8_t *data = phys_mem_ptr(i * TRACE_PAGE_SIZE, TRACE_PAGE_SIZE);
+            trace_put32(file, i * TRACE_PAGE_SIZE);
+            fwrite(data ? data : unmapped, 1, TRACE_PAGE_SIZE, file);
+        }
+    }
+
+    ok = !ferror(file);
+    ok = !fclose(file) && ok;
+    return ok;
+}
+
+#endif
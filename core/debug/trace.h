@@ -0,0 +1,93 @@
+#ifdef DEBUG_SUPPORT
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Records every instruction that runs into a ring buffer, so the last few million before a crash can be looked
+ * at afterwards. The ring is split into chunks that each start from a known cycle and PC, so dropping the oldest
+ * chunk keeps the rest decodable.
+ *
+ * A saved trace is, little endian throughout:
+ *   TRACE_MAGIC
+ *   u32 chunk count, then for each chunk from the oldest: u64 cycle its first instruction started at,
+ *       u32 instructions, u32 bytes, and the records
+ *   u32 page count, then for each page: u32 address, then TRACE_PAGE_SIZE bytes of memory as it was when saved
+ * The pages hold the code that ran, so the trace can be disassembled without the emulator.
+ *
+ * Each instruction is a tag byte, then its PC, then the cycles since the instruction before it started if they
+ * don't fit in the tag:
+ *   tag & TRACE_TAG_PC       how the PC follows: a signed byte or word added to the last PC, or all three bytes
+ *   tag & TRACE_TAG_CYCLES   the cycles, or TRACE_CYCLES_MORE for a varint of the cycles minus TRACE_CYCLES_MORE;
+ *                            always 0 for the first instruction of a chunk
+ * A tag with TRACE_PC_MARK is not an instruction but something that happened after the last one:
+ *   TRACE_MARK_WRITE         it wrote to memory: u24 address, u8 value
+ *   TRACE_MARK_DROPPED       it wrote more than TRACE_WRITES times: varint of the writes left out
+ *   TRACE_MARK_INTERRUPT     an interrupt was taken before the next one
+ * Varints are little endian groups of seven bits, with the top bit set on all but the last.
+ */
+
+#define TRACE_MAGIC          "CEmuTrc1"
+#define TRACE_MAGIC_SIZE     8
+#define TRACE_CHUNK_SIZE     0x10000
+#define TRACE_PAGE_SIZE      0x100
+#define TRACE_WRITES         8          /* Writes kept per instruction; block instructions can do many more */
+
+#define TRACE_TAG_ADL        0x80
+#define TRACE_TAG_PC         0x60
+#define TRACE_TAG_CYCLES     0x1F
+
+#define TRACE_PC_BYTE        0x00
+#define TRACE_PC_WORD        0x20
+#define TRACE_PC_LONG        0x40
+#define TRACE_PC_MARK        0x60
+
+#define TRACE_CYCLES_MORE    0x1F
+
+#define TRACE_MARK_WRITE     (TRACE_PC_MARK | 0)
+#define TRACE_MARK_DROPPED   (TRACE_PC_MARK | 1)
+#define TRACE_MARK_INTERRUPT (TRACE_PC_MARK | 2)
+
+/* When to save the trace without being asked */
+#define TRACE_SAVE_BREAKPOINT (1 << 0)
+#define TRACE_SAVE_TRAP       (1 << 1)
+
+typedef struct {
+    bool active;
+    bool writes;                /* Also record what each instruction writes to memory */
+} trace_t;
+
+/* writes is checked on every memory write as well */
+extern trace_t trace;
+
+/* Starts an empty ring of size bytes, split into chunks; false without the memory for it */
+bool trace_start(uint32_t size, bool writes);
+void trace_stop(void);
+void trace_free(void);
+/* Instructions in the trace now */
+uint64_t trace_instructions(void);
+/* Write the trace, ending with the instruction running now; false if it couldn't be written */
+bool trace_save(const char *path);
+/* Save to path whenever one of the TRACE_SAVE events happens while recording; NULL or 0 to stop */
+void trace_save_on(const char *path, unsigned int events);
+
+/* Hooks */
+void trace_instruction(uint32_t pc);                /* Before each instruction */
+void trace_interrupt(void);                         /* When an interrupt is taken */
+void trace_write(uint32_t address, uint8_t value);  /* Each memory write, when trace.writes is set */
+void trace_event(unsigned int event);               /* A TRACE_SAVE event happened */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+#endif
@@ -25,7 +25,10 @@
 #include "schedule.h"
 #include "asic.h"
 #include "cert.h"
+#include "lcdhash.h"
+#include "perf.h"
 #include "os/os.h"
+#include "debug/timeline.h"
 
 #define imageVersion 0xCECE0003
 
@@ -33,11 +36,28 @@ uint32_t cpuEvents;
 volatile bool exiting;
 
 void throttle_interval_event(int index) {
+    uint32_t host;
     event_repeat(index, 27000000 / 60);
 
+    lcd_wait_poll();
+    perf.cycles = sched_total_cycles();
+
+    host = perf_host_switch(PERF_HOST_GUI);
     gui_do_stuff();
 
+    perf_host_switch(PERF_HOST_THROTTLE);
+#ifdef DEBUG_SUPPORT
+    if (timeline.active) {
+        timeline_handle_t handle = timeline_begin(TIMELINE_THROTTLE, 0);
+        throttle_timer_wait();
+        timeline_end(handle);
+    } else {
+        throttle_timer_wait();
+    }
+#else
     throttle_timer_wait();
+#endif
+    perf_host_switch(host);
 }
 
 bool emu_save_rom(const char *file) {
@@ -339,7 +359,9 @@ static void emu_main_loop_inner(void) {
             sched_process_pending_events();
             cpu_execute();
         } else {
+            uint32_t host = perf_host_switch(PERF_HOST_THROTTLE);
             gui_emu_sleep();
+            perf_host_switch(host);
         }
 }
 
@@ -349,6 +371,7 @@ void emu_loop(bool reset) {
     }
 
     exiting = false;
+    perf_reset();
 
 #ifdef __EMSCRIPTEN__
     emscripten_set_main_loop(emu_main_loop_inner, 0, 1);
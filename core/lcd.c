@@ -19,31 +19,41 @@
 #include "interrupt.h"
 #include "cpu.h"
 #include "emu.h"
+#include "backlight.h"
+#include "lcdstream.h"
+#include "lcdhash.h"
+#include "shmexport.h"
+#include "perf.h"
 
 /* Global LCD state */
 lcd_state_t lcd;
 
-uint32_t lcd_framebuffer[320*240];
+/* Dirty scanline state */
+lcd_dirty_state_t lcd_dirty;
 
-static const uint32_t vram_size = 320 * 240 * 2;
 static const uint32_t lcd_dma_size = 0x80000;
 
 void (*lcd_event_gui_callback)(void) = NULL;
 
-static uint_fast32_t lcd_nextword(uint32_t *ofs) {
-    uint_fast32_t word = 0;
-    *ofs &= lcd_dma_size - 1;
-    if (*ofs < ram_size) {
-        word = *(uint32_t *) (mem.ram.block + *ofs);
-    }
-    *ofs += 4;
-    return word;
-}
+/* Conversion parameters shared by every row of a frame */
+typedef struct lcd_convert {
+    uint_fast8_t mode;
+    bool rgb;
+    bool bebo;
+    uint32_t scale;                 /* Backlight dimming applied to each channel, out of 256 */
+    uint_fast8_t shifts[32];        /* Bit position of each pixel in a word for the paletted modes */
+    uint32_t palette[0x100];        /* Palette resolved to RGBA8888 for the paletted modes */
+} lcd_convert_t;
+
+typedef void (*lcd_row_kernel_t)(uint32_t *out, const uint8_t *in, const lcd_convert_t *conv);
+
+/* Number of bytes of VRAM making up one row, indexed by mode */
+static const uint32_t lcd_row_bytes[8] = { 40, 80, 160, 320, 640, 1280, 640, 640 };
 
 // #define c6_to_c8(c) ((c * 0xFF + 0x1F) / 0x3F)
 #define c6_to_c8(c) ((c << 2) | (c >> 4))
 
-static void lcd_bgr16out(uint_fast32_t bgr16, bool rgb, uint32_t **out) {
+static uint32_t lcd_bgr16out(uint_fast32_t bgr16, bool rgb, uint32_t scale) {
     uint_fast32_t r, g, b;
 
     r = (rgb ? bgr16 >> 10 : bgr16 << 1) & 0x3E;
@@ -57,96 +67,707 @@ static void lcd_bgr16out(uint_fast32_t bgr16, bool rgb, uint32_t **out) {
     b |= b >> 5;
     b = c6_to_c8(b);
 
-    *(*out)++ = r | (g << 8) | (b << 16) | (0xFFu << 24);
-}
+    r = r * scale >> 8;
+    g = g * scale >> 8;
+    b = b * scale >> 8;
 
-/* Draw the current screen into a 320*240*4-byte RGBA8888 buffer. Alpha is always 255. */
-void lcd_drawframe(uint32_t *out, lcd_state_t *lcd_state) {
-    uint_fast8_t mode = lcd_state->control >> 1 & 7;
-    bool rgb = lcd_state->control & (1 << 8);
-    bool bebo = lcd_state->control & (1 << 9);
-    uint_fast32_t words = 320 * 240;
-    uint_fast32_t word, color;
-    uint32_t ofs = lcd_state->upcurr & ~7;
+    return r | (g << 8) | (b << 16) | (0xFFu << 24);
+}
 
-    if(!mem.ram.block) {
-        memset(out, 0, vram_size << 1);
-        return;
+/* Convert a pixel from any of the 12/16bpp encodings to the 5:6:5 layout lcd_bgr16out() expects */
+static uint_fast32_t lcd_normalize16(uint_fast32_t color, uint_fast8_t mode) {
+    switch (mode) {
+        case 4: /* 1:5:5:5 */
+            return color + (color & 0xFFE0) + (color >> 10 & 0x20);
+        case 7: /* 4:4:4 */
+            return (color << 4 & 0xF000) | (color << 3 & 0x780) | (color << 1 & 0x1E);
+        default: /* 5:6:5 */
+            return color;
     }
+}
 
-    if (mode < 4) {
-        uint_fast8_t bpp = 1 << mode;
-        uint_fast32_t mask = (1 << bpp) - 1;
-        uint_fast8_t bi = bebo ? 0 : 24;
-        bool bepo = lcd_state->control & (1 << 10);
-        if (!bepo) {
-            bi ^= (8 - bpp);
+static uint_fast32_t lcd_normalize24(uint_fast32_t word) {
+    return (word >> 8 & 0xF800) | (word >> 5 & 0x7E0) | (word >> 3 & 0x1F);
+}
+
+static void lcd_row_palette(uint32_t *out, const uint8_t *in, const lcd_convert_t *conv) {
+    uint_fast8_t bpp = 1 << conv->mode;
+    uint_fast8_t count = 32 >> conv->mode;
+    uint_fast32_t mask = (1 << bpp) - 1;
+    uint32_t *end = out + 320;
+
+    do {
+        uint_fast8_t i;
+        uint32_t word;
+        memcpy(&word, in, sizeof(word));
+        in += 4;
+        for (i = 0; i < count; i++) {
+            *out++ = conv->palette[word >> conv->shifts[i] & mask];
         }
-        do {
-            uint_fast8_t bitpos = 32;
-            word = lcd_nextword(&ofs);
-            do {
-                color = lcd.palette[word >> ((bitpos -= bpp) ^ bi) & mask];
-                lcd_bgr16out(color + (color & 0xFFE0) + (color >> 10 & 0x20), rgb, &out);
-                words--;
-            } while (bitpos != 0);
-        } while (words != 0);
-
-    } else if (mode == 4) {
-        do {
-            uint_fast8_t i = 2;
-            word = lcd_nextword(&ofs);
-            if (bebo) {
+    } while (out != end);
+}
+
+static void lcd_row_scalar(uint32_t *out, const uint8_t *in, const lcd_convert_t *conv) {
+    uint16_t row[320];
+    uint_fast16_t i;
+    uint32_t word;
+
+    /* Bring every pixel to 5:6:5 first so the per-pixel loops below have no mode or order checks */
+    if (conv->mode == 5) {
+        for (i = 0; i < 320; i++, in += 4) {
+            memcpy(&word, in, sizeof(word));
+            row[i] = lcd_normalize24(word);
+        }
+    } else {
+        for (i = 0; i < 320; i += 2, in += 4) {
+            memcpy(&word, in, sizeof(word));
+            if (conv->bebo) {
                 word = word << 16 | word >> 16;
             }
-            do {
-                color = word;
-                lcd_bgr16out(color + (color & 0xFFE0) + (color >> 10 & 0x20), rgb, &out);
-                word >>= 16;
-                words--;
-            } while (--i != 0);
-        } while (words != 0);
-
-    } else if (mode == 5) {
-        do {
-            word = lcd_nextword(&ofs);
-            lcd_bgr16out((word >> 8 & 0xF800) | (word >> 5 & 0x7E0) | (word >> 3 & 0x1F), rgb, &out);
-            words--;
-        } while (words != 0);
+            row[i] = lcd_normalize16(word & 0xFFFF, conv->mode);
+            row[i + 1] = lcd_normalize16(word >> 16, conv->mode);
+        }
+    }
 
-    } else if (mode == 6) {
-        do {
-            uint_fast8_t i = 2;
-            word = lcd_nextword(&ofs);
-            if (bebo) {
-                word = word << 16 | word >> 16;
+    if (conv->rgb) {
+        for (i = 0; i < 320; i++) {
+            out[i] = lcd_bgr16out(row[i], true, conv->scale);
+        }
+    } else {
+        for (i = 0; i < 320; i++) {
+            out[i] = lcd_bgr16out(row[i], false, conv->scale);
+        }
+    }
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LCD_SIMD_X86
+#define LCD_TARGET_SSE2 __attribute__((target("sse2")))
+#define LCD_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define LCD_SIMD_SSE2_ONLY
+#define LCD_TARGET_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LCD_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(LCD_SIMD_X86) || defined(LCD_SIMD_SSE2_ONLY)
+/* Widen 5 and 6 bit channels to 8 bits exactly like c6_to_c8() does */
+LCD_TARGET_SSE2 static __m128i lcd_sse2_expand5(__m128i c) {
+    c = _mm_or_si128(_mm_slli_epi16(c, 1), _mm_srli_epi16(c, 4));
+    return _mm_or_si128(_mm_slli_epi16(c, 2), _mm_srli_epi16(c, 4));
+}
+
+LCD_TARGET_SSE2 static __m128i lcd_sse2_expand6(__m128i c) {
+    return _mm_or_si128(_mm_slli_epi16(c, 2), _mm_srli_epi16(c, 4));
+}
+
+LCD_TARGET_SSE2 static __m128i lcd_sse2_normalize16(__m128i v, uint_fast8_t mode) {
+    switch (mode) {
+        case 4:
+            return _mm_add_epi16(_mm_add_epi16(v, _mm_and_si128(v, _mm_set1_epi16((short)0xFFE0))),
+                                 _mm_and_si128(_mm_srli_epi16(v, 10), _mm_set1_epi16(0x20)));
+        case 7:
+            return _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_slli_epi16(v, 4), _mm_set1_epi16((short)0xF000)),
+                                             _mm_and_si128(_mm_slli_epi16(v, 3), _mm_set1_epi16(0x780))),
+                                _mm_and_si128(_mm_slli_epi16(v, 1), _mm_set1_epi16(0x1E)));
+        default:
+            return v;
+    }
+}
+
+/* Four 24bpp words to four 5:6:5 values, sign extended so they survive the saturating pack */
+LCD_TARGET_SSE2 static __m128i lcd_sse2_normalize24(__m128i w) {
+    __m128i v = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(w, 8), _mm_set1_epi32(0xF800)),
+                                          _mm_and_si128(_mm_srli_epi32(w, 5), _mm_set1_epi32(0x7E0))),
+                             _mm_and_si128(_mm_srli_epi32(w, 3), _mm_set1_epi32(0x1F)));
+    return _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+}
+
+LCD_TARGET_SSE2 static void lcd_sse2_out(uint32_t *out, __m128i v, const lcd_convert_t *conv) {
+    __m128i scale = _mm_set1_epi16((short)conv->scale);
+    __m128i hi = lcd_sse2_expand5(_mm_srli_epi16(v, 11));
+    __m128i lo = lcd_sse2_expand5(_mm_and_si128(v, _mm_set1_epi16(0x1F)));
+    __m128i g = lcd_sse2_expand6(_mm_and_si128(_mm_srli_epi16(v, 5), _mm_set1_epi16(0x3F)));
+    __m128i r = conv->rgb ? hi : lo;
+    __m128i b = conv->rgb ? lo : hi;
+    __m128i rg, ba;
+
+    r = _mm_srli_epi16(_mm_mullo_epi16(r, scale), 8);
+    g = _mm_srli_epi16(_mm_mullo_epi16(g, scale), 8);
+    b = _mm_srli_epi16(_mm_mullo_epi16(b, scale), 8);
+
+    rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+    ba = _mm_or_si128(b, _mm_set1_epi16((short)0xFF00));
+    _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128((__m128i *)(out + 4), _mm_unpackhi_epi16(rg, ba));
+}
+
+LCD_TARGET_SSE2 static void lcd_row_sse2(uint32_t *out, const uint8_t *in, const lcd_convert_t *conv) {
+    uint_fast16_t i;
+
+    if (conv->mode == 5) {
+        for (i = 0; i < 320; i += 8) {
+            __m128i a = lcd_sse2_normalize24(_mm_loadu_si128((const __m128i *)(in + i * 4)));
+            __m128i b = lcd_sse2_normalize24(_mm_loadu_si128((const __m128i *)(in + i * 4 + 16)));
+            lcd_sse2_out(out + i, _mm_packs_epi32(a, b), conv);
+        }
+    } else {
+        for (i = 0; i < 320; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(in + i * 2));
+            if (conv->bebo) {
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
             }
-            do {
-                lcd_bgr16out(word, rgb, &out);
-                word >>= 16;
-                words--;
-            } while (--i != 0);
-        } while (words != 0);
+            lcd_sse2_out(out + i, lcd_sse2_normalize16(v, conv->mode), conv);
+        }
+    }
+}
+#endif
 
+#ifdef LCD_SIMD_X86
+LCD_TARGET_AVX2 static __m256i lcd_avx2_expand5(__m256i c) {
+    c = _mm256_or_si256(_mm256_slli_epi16(c, 1), _mm256_srli_epi16(c, 4));
+    return _mm256_or_si256(_mm256_slli_epi16(c, 2), _mm256_srli_epi16(c, 4));
+}
+
+LCD_TARGET_AVX2 static __m256i lcd_avx2_expand6(__m256i c) {
+    return _mm256_or_si256(_mm256_slli_epi16(c, 2), _mm256_srli_epi16(c, 4));
+}
+
+LCD_TARGET_AVX2 static __m256i lcd_avx2_normalize16(__m256i v, uint_fast8_t mode) {
+    switch (mode) {
+        case 4:
+            return _mm256_add_epi16(_mm256_add_epi16(v, _mm256_and_si256(v, _mm256_set1_epi16((short)0xFFE0))),
+                                    _mm256_and_si256(_mm256_srli_epi16(v, 10), _mm256_set1_epi16(0x20)));
+        case 7:
+            return _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(v, 4), _mm256_set1_epi16((short)0xF000)),
+                                                   _mm256_and_si256(_mm256_slli_epi16(v, 3), _mm256_set1_epi16(0x780))),
+                                   _mm256_and_si256(_mm256_slli_epi16(v, 1), _mm256_set1_epi16(0x1E)));
+        default:
+            return v;
+    }
+}
+
+LCD_TARGET_AVX2 static __m256i lcd_avx2_normalize24(__m256i w) {
+    __m256i v = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(w, 8), _mm256_set1_epi32(0xF800)),
+                                                _mm256_and_si256(_mm256_srli_epi32(w, 5), _mm256_set1_epi32(0x7E0))),
+                                _mm256_and_si256(_mm256_srli_epi32(w, 3), _mm256_set1_epi32(0x1F)));
+    return _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16);
+}
+
+LCD_TARGET_AVX2 static void lcd_avx2_out(uint32_t *out, __m256i v, const lcd_convert_t *conv) {
+    __m256i scale = _mm256_set1_epi16((short)conv->scale);
+    __m256i hi = lcd_avx2_expand5(_mm256_srli_epi16(v, 11));
+    __m256i lo = lcd_avx2_expand5(_mm256_and_si256(v, _mm256_set1_epi16(0x1F)));
+    __m256i g = lcd_avx2_expand6(_mm256_and_si256(_mm256_srli_epi16(v, 5), _mm256_set1_epi16(0x3F)));
+    __m256i r = conv->rgb ? hi : lo;
+    __m256i b = conv->rgb ? lo : hi;
+    __m256i rg, ba, first, second;
+
+    r = _mm256_srli_epi16(_mm256_mullo_epi16(r, scale), 8);
+    g = _mm256_srli_epi16(_mm256_mullo_epi16(g, scale), 8);
+    b = _mm256_srli_epi16(_mm256_mullo_epi16(b, scale), 8);
+
+    rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+    ba = _mm256_or_si256(b, _mm256_set1_epi16((short)0xFF00));
+
+    /* Unpacking works per 128-bit lane, so put pixels 0-7 and 8-15 back together */
+    first = _mm256_unpacklo_epi16(rg, ba);
+    second = _mm256_unpackhi_epi16(rg, ba);
+    _mm256_storeu_si256((__m256i *)out, _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256((__m256i *)(out + 8), _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+LCD_TARGET_AVX2 static void lcd_row_avx2(uint32_t *out, const uint8_t *in, const lcd_convert_t *conv) {
+    uint_fast16_t i;
+
+    if (conv->mode == 5) {
+        for (i = 0; i < 320; i += 16) {
+            __m256i a = lcd_avx2_normalize24(_mm256_loadu_si256((const __m256i *)(in + i * 4)));
+            __m256i b = lcd_avx2_normalize24(_mm256_loadu_si256((const __m256i *)(in + i * 4 + 32)));
+            lcd_avx2_out(out + i, _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8), conv);
+        }
     } else {
+        const __m256i swap = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+                                              2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+        for (i = 0; i < 320; i += 16) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(in + i * 2));
+            if (conv->bebo) {
+                v = _mm256_shuffle_epi8(v, swap);
+            }
+            lcd_avx2_out(out + i, lcd_avx2_normalize16(v, conv->mode), conv);
+        }
+    }
+}
+#endif
+
+#ifdef LCD_SIMD_NEON
+static uint16x8_t lcd_neon_expand5(uint16x8_t c) {
+    c = vorrq_u16(vshlq_n_u16(c, 1), vshrq_n_u16(c, 4));
+    return vorrq_u16(vshlq_n_u16(c, 2), vshrq_n_u16(c, 4));
+}
+
+static uint16x8_t lcd_neon_expand6(uint16x8_t c) {
+    return vorrq_u16(vshlq_n_u16(c, 2), vshrq_n_u16(c, 4));
+}
+
+static uint16x8_t lcd_neon_normalize16(uint16x8_t v, uint_fast8_t mode) {
+    switch (mode) {
+        case 4:
+            return vaddq_u16(vaddq_u16(v, vandq_u16(v, vdupq_n_u16(0xFFE0))),
+                             vandq_u16(vshrq_n_u16(v, 10), vdupq_n_u16(0x20)));
+        case 7:
+            return vorrq_u16(vorrq_u16(vandq_u16(vshlq_n_u16(v, 4), vdupq_n_u16(0xF000)),
+                                       vandq_u16(vshlq_n_u16(v, 3), vdupq_n_u16(0x780))),
+                             vandq_u16(vshlq_n_u16(v, 1), vdupq_n_u16(0x1E)));
+        default:
+            return v;
+    }
+}
+
+static uint16x4_t lcd_neon_normalize24(uint32x4_t w) {
+    uint32x4_t v = vorrq_u32(vorrq_u32(vandq_u32(vshrq_n_u32(w, 8), vdupq_n_u32(0xF800)),
+                                       vandq_u32(vshrq_n_u32(w, 5), vdupq_n_u32(0x7E0))),
+                             vandq_u32(vshrq_n_u32(w, 3), vdupq_n_u32(0x1F)));
+    return vmovn_u32(v);
+}
+
+static void lcd_neon_out(uint32_t *out, uint16x8_t v, const lcd_convert_t *conv) {
+    uint16x8_t scale = vdupq_n_u16((uint16_t)conv->scale);
+    uint16x8_t hi = lcd_neon_expand5(vshrq_n_u16(v, 11));
+    uint16x8_t lo = lcd_neon_expand5(vandq_u16(v, vdupq_n_u16(0x1F)));
+    uint16x8_t g = lcd_neon_expand6(vandq_u16(vshrq_n_u16(v, 5), vdupq_n_u16(0x3F)));
+    uint8x8x4_t px;
+
+    px.val[0] = vmovn_u16(vshrq_n_u16(vmulq_u16(conv->rgb ? hi : lo, scale), 8));
+    px.val[1] = vmovn_u16(vshrq_n_u16(vmulq_u16(g, scale), 8));
+    px.val[2] = vmovn_u16(vshrq_n_u16(vmulq_u16(conv->rgb ? lo : hi, scale), 8));
+    px.val[3] = vdup_n_u8(0xFF);
+    vst4_u8((uint8_t *)out, px);
+}
+
+static void lcd_row_neon(uint32_t *out, const uint8_t *in, const lcd_convert_t *conv) {
+    uint_fast16_t i;
+
+    if (conv->mode == 5) {
+        for (i = 0; i < 320; i += 8) {
+            uint16x4_t a = lcd_neon_normalize24(vld1q_u32((const uint32_t *)(in + i * 4)));
+            uint16x4_t b = lcd_neon_normalize24(vld1q_u32((const uint32_t *)(in + i * 4 + 16)));
+            lcd_neon_out(out + i, vcombine_u16(a, b), conv);
+        }
+    } else {
+        for (i = 0; i < 320; i += 8) {
+            uint16x8_t v = vld1q_u16((const uint16_t *)(in + i * 2));
+            if (conv->bebo) {
+                v = vrev32q_u16(v);
+            }
+            lcd_neon_out(out + i, lcd_neon_normalize16(v, conv->mode), conv);
+        }
+    }
+}
+#endif
+
+typedef void (*lcd_scale_kernel_t)(uint32_t *out, const uint32_t *in, uint32_t factor, uint32_t scale);
+
+static void lcd_scale_scalar(uint32_t *out, const uint32_t *in, uint32_t factor, uint32_t scale) {
+    uint_fast16_t i;
+    uint32_t j;
+
+    for (i = 0; i < 320; i++) {
+        uint32_t c = in[i];
+        if (scale < 256) {
+            c = ((c       & 0xFF) * scale >> 8)
+              | ((c >>  8 & 0xFF) * scale >> 8) << 8
+              | ((c >> 16 & 0xFF) * scale >> 8) << 16
+              | (c & 0xFF000000);
+        }
+        for (j = 0; j < factor; j++) {
+            *out++ = c;
+        }
+    }
+}
+
+#if defined(LCD_SIMD_X86) || defined(LCD_SIMD_SSE2_ONLY)
+/* Multiply the color channels of four RGBA pixels by mul (alpha lanes hold 256) */
+LCD_TARGET_SSE2 static __m128i lcd_sse2_dim(__m128i v, __m128i mul) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), mul), 8);
+    __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), mul), 8);
+    return _mm_packus_epi16(lo, hi);
+}
+
+LCD_TARGET_SSE2 static void lcd_scale_sse2(uint32_t *out, const uint32_t *in, uint32_t factor, uint32_t scale) {
+    const __m128i mul = _mm_set_epi16(256, (short)scale, (short)scale, (short)scale,
+                                      256, (short)scale, (short)scale, (short)scale);
+    uint_fast16_t i;
+    uint32_t j;
+
+    for (i = 0; i < 320; i += 4, out += factor * 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(in + i));
+        if (scale < 256) {
+            v = lcd_sse2_dim(v, mul);
+        }
+        switch (factor) {
+            case 1:
+                _mm_storeu_si128((__m128i *)out, v);
+                break;
+            case 2:
+                _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi32(v, v));
+                _mm_storeu_si128((__m128i *)(out + 4), _mm_unpackhi_epi32(v, v));
+                break;
+            case 3:
+                _mm_storeu_si128((__m128i *)out, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 0, 0)));
+                _mm_storeu_si128((__m128i *)(out + 4), _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 2, 1, 1)));
+                _mm_storeu_si128((__m128i *)(out + 8), _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 2)));
+                break;
+            case 4:
+                _mm_storeu_si128((__m128i *)out, _mm_shuffle_epi32(v, 0x00));
+                _mm_storeu_si128((__m128i *)(out + 4), _mm_shuffle_epi32(v, 0x55));
+                _mm_storeu_si128((__m128i *)(out + 8), _mm_shuffle_epi32(v, 0xAA));
+                _mm_storeu_si128((__m128i *)(out + 12), _mm_shuffle_epi32(v, 0xFF));
+                break;
+            default: {
+                /* Splat each pixel; the last store of a run overlaps the previous one instead of running past it */
+                __m128i p[4];
+                uint_fast8_t k;
+                p[0] = _mm_shuffle_epi32(v, 0x00);
+                p[1] = _mm_shuffle_epi32(v, 0x55);
+                p[2] = _mm_shuffle_epi32(v, 0xAA);
+                p[3] = _mm_shuffle_epi32(v, 0xFF);
+                for (k = 0; k < 4; k++) {
+                    uint32_t *dst = out + k * factor;
+                    for (j = 0; j + 4 <= factor; j += 4) {
+                        _mm_storeu_si128((__m128i *)(dst + j), p[k]);
+                    }
+                    if (j < factor) {
+                        _mm_storeu_si128((__m128i *)(dst + factor - 4), p[k]);
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+#endif
+
+#ifdef LCD_SIMD_NEON
+static void lcd_scale_neon(uint32_t *out, const uint32_t *in, uint32_t factor, uint32_t scale) {
+    const uint16_t muls[8] = { (uint16_t)scale, (uint16_t)scale, (uint16_t)scale, 256,
+                               (uint16_t)scale, (uint16_t)scale, (uint16_t)scale, 256 };
+    const uint16x8_t mul = vld1q_u16(muls);
+    uint_fast16_t i;
+    uint32_t j;
+
+    for (i = 0; i < 320; i += 4, out += factor * 4) {
+        uint32x4_t v = vld1q_u32(in + i);
+        if (scale < 256) {
+            uint8x16_t b = vreinterpretq_u8_u32(v);
+            uint8x8_t lo = vshrn_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(b)), mul), 8);
+            uint8x8_t hi = vshrn_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(b)), mul), 8);
+            v = vreinterpretq_u32_u8(vcombine_u8(lo, hi));
+        }
+        if (factor == 1) {
+            vst1q_u32(out, v);
+        } else if (factor == 2) {
+            uint32x4x2_t z = vzipq_u32(v, v);
+            vst1q_u32(out, z.val[0]);
+            vst1q_u32(out + 4, z.val[1]);
+        } else {
+            uint32_t px[4];
+            uint_fast8_t k;
+            vst1q_u32(px, v);
+            for (k = 0; k < 4; k++) {
+                uint32x4_t p = vdupq_n_u32(px[k]);
+                uint32_t *dst = out + k * factor;
+                for (j = 0; j + 4 <= factor; j += 4) {
+                    vst1q_u32(dst + j, p);
+                }
+                for (; j < factor; j++) {
+                    dst[j] = px[k];
+                }
+            }
+        }
+    }
+}
+#endif
+
+static lcd_scale_kernel_t lcd_select_scale_kernel(void) {
+#if defined(LCD_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) {
+        return lcd_scale_sse2;
+    }
+#elif defined(LCD_SIMD_SSE2_ONLY)
+    return lcd_scale_sse2;
+#elif defined(LCD_SIMD_NEON)
+    return lcd_scale_neon;
+#endif
+    return lcd_scale_scalar;
+}
+
+static lcd_scale_kernel_t lcd_scale_kernel = NULL;
+
+/* Pick the widest row kernel the host supports; NEON is always present where it is compiled in */
+static lcd_row_kernel_t lcd_select_kernel(void) {
+#if defined(LCD_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return lcd_row_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return lcd_row_sse2;
+    }
+#elif defined(LCD_SIMD_SSE2_ONLY)
+    return lcd_row_sse2;
+#elif defined(LCD_SIMD_NEON)
+    return lcd_row_neon;
+#endif
+    return lcd_row_scalar;
+}
+
+static lcd_row_kernel_t lcd_row_kernel = NULL;
+
+/* Backlight level to a per-channel multiplier out of 256 */
+static uint32_t lcd_backlight_scale(uint8_t brightness) {
+    uint32_t scale = (310 - brightness) * 256 / 160;
+    return scale > 256 ? 256 : scale;
+}
+
+static void lcd_convert_setup(lcd_convert_t *conv, const lcd_state_t *lcd_state, uint32_t scale) {
+    conv->mode = lcd_state->control >> 1 & 7;
+    conv->rgb = lcd_state->control & (1 << 8);
+    conv->bebo = lcd_state->control & (1 << 9);
+    conv->scale = scale;
+
+    if (conv->mode < 4) {
+        uint_fast8_t bpp = 1 << conv->mode;
+        uint_fast8_t bi = conv->bebo ? 0 : 24;
+        uint_fast8_t bitpos = 32;
+        uint_fast16_t i = 0;
+        bool bepo = lcd_state->control & (1 << 10);
+        if (!bepo) {
+            bi ^= (8 - bpp);
+        }
         do {
-            uint_fast8_t i = 2;
-            word = lcd_nextword(&ofs);
-            if (bebo) {
-                word = word << 16 | word >> 16;
+            conv->shifts[i++] = (bitpos -= bpp) ^ bi;
+        } while (bitpos != 0);
+        for (i = 0; i < 0x100; i++) {
+            conv->palette[i] = lcd_bgr16out(lcd_normalize16(lcd.palette[i], 4), conv->rgb, scale);
+        }
+    }
+}
+
+/* Fetch a row that wraps the DMA window or runs off the end of RAM a word at a time */
+static void lcd_fetch_row(uint8_t *row, uint32_t ofs, uint32_t bytes) {
+    uint32_t i;
+    for (i = 0; i < bytes; i += 4) {
+        uint32_t addr = (ofs + i) & (lcd_dma_size - 1);
+        if (addr < ram_size) {
+            memcpy(row + i, mem.ram.block + addr, 4);
+        } else {
+            memset(row + i, 0, 4);
+        }
+    }
+}
+
+/* Convert the rows whose bit is set in rows, or every row if rows is NULL */
+static void lcd_convert_rows(uint32_t *out, const lcd_state_t *lcd_state, uint32_t scale, const uint32_t *rows) {
+    lcd_convert_t conv;
+    ALIGNED_(32) uint8_t row[1280];
+    lcd_row_kernel_t kernel;
+    uint32_t bytes, ofs;
+    uint_fast8_t y;
+
+    if (!lcd_row_kernel) {
+        lcd_row_kernel = lcd_select_kernel();
+    }
+
+    lcd_convert_setup(&conv, lcd_state, scale);
+    kernel = conv.mode < 4 ? lcd_row_palette : lcd_row_kernel;
+    bytes = lcd_row_bytes[conv.mode];
+    ofs = lcd_state->upcurr & ~7;
+
+    for (y = 0; y < 240; y++, ofs += bytes, out += 320) {
+        uint32_t start = ofs & (lcd_dma_size - 1);
+        if (rows && !(rows[y >> 5] & (1u << (y & 31)))) {
+            continue;
+        }
+        if (start + bytes <= ram_size) {
+            kernel(out, mem.ram.block + start, &conv);
+        } else {
+            lcd_fetch_row(row, ofs, bytes);
+            kernel(out, row, &conv);
+        }
+    }
+}
+
+/* Draw the current screen into a 320*240*4-byte RGBA8888 buffer. Alpha is always 255. */
+void lcd_drawframe(uint32_t *out, lcd_state_t *lcd_state) {
+    if(!mem.ram.block) {
+        memset(out, 0, 320 * 240 * 4);
+        return;
+    }
+
+    lcd_convert_rows(out, lcd_state, 256, NULL);
+}
+
+/* Same as lcd_drawframe(), but darkened the way the panel looks at the given backlight level */
+void lcd_drawframe_dimmed(uint32_t *out, lcd_state_t *lcd_state, uint8_t brightness) {
+    if(!mem.ram.block) {
+        memset(out, 0, 320 * 240 * 4);
+        return;
+    }
+
+    lcd_convert_rows(out, lcd_state, lcd_backlight_scale(brightness), NULL);
+}
+
+void lcd_scale_row(uint32_t *out, const uint32_t *in, uint32_t factor, uint8_t brightness) {
+    if (!lcd_scale_kernel) {
+        lcd_scale_kernel = lcd_select_scale_kernel();
+    }
+    lcd_scale_kernel(out, in, factor, lcd_backlight_scale(brightness));
+}
+
+/* Work out which part of RAM the upcurr window covers; writes there mark scanlines dirty */
+static void lcd_dirty_window(void) {
+    uint32_t bytes = lcd_row_bytes[lcd.control >> 1 & 7];
+    uint32_t start = lcd.upcurr & (lcd_dma_size - 1) & ~7;
+
+    lcd_dirty.start = start;
+    lcd_dirty.rowBytes = bytes;
+    /* A window that wraps or runs off the end of RAM is simply redrawn in full every time */
+    lcd_dirty.size = start + bytes * 240 <= ram_size ? bytes * 240 : 0;
+    lcd_dirty.all = true;
+}
+
+void lcd_invalidate(void) {
+    lcd_dirty.all = true;
+}
+
+void lcd_mark_dirty(uint32_t offset, uint32_t size) {
+    uint32_t first, last;
+
+    if (!size || !lcd_dirty.size || offset >= lcd_dirty.start + lcd_dirty.size || offset + size <= lcd_dirty.start) {
+        return;
+    }
+
+    first = offset > lcd_dirty.start ? (offset - lcd_dirty.start) / lcd_dirty.rowBytes : 0;
+    last = (offset + size - 1 - lcd_dirty.start) / lcd_dirty.rowBytes;
+    if (last > 239) {
+        last = 239;
+    }
+
+    for (; first <= last; first++) {
+        lcd_dirty.rows[first >> 5] |= 1u << (first & 31);
+    }
+}
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define lcd_atomic_exchange(ptr, value) ((uint32_t)InterlockedExchange((volatile LONG *)(ptr), (LONG)(value)))
+#define lcd_atomic_load(ptr) ((uint32_t)InterlockedCompareExchange((volatile LONG *)(ptr), 0, 0))
+#else
+#define lcd_atomic_exchange(ptr, value) __atomic_exchange_n((ptr), (value), __ATOMIC_ACQ_REL)
+#define lcd_atomic_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#endif
+
+/*
+ * Triple buffer of converted frames. The emulation thread owns back, the reading thread owns front, and the
+ * remaining slot is parked in ready together with a flag telling whether it holds a frame the reader has not
+ * picked up yet. Both sides only ever swap their own slot with the parked one.
+ */
+#define LCD_FRAME_FRESH 4
+
+static lcd_frame_t lcd_frames[3];
+static uint32_t lcd_frame_back = 0, lcd_frame_front = 2, lcd_frame_last = 1;
+static volatile uint32_t lcd_frame_ready = 1;
+static volatile uint32_t lcd_frame_count;
+static uint32_t lcd_frame_pending[3][8];     /* Scanlines each slot is behind on */
+
+/* Convert the scanlines that changed into the back buffer and hand it over to readers */
+static void lcd_frame_publish(void) {
+    static uint32_t drawnControl, drawnBase;
+    static uint16_t drawnPalette[0x100];
+    lcd_frame_t *frame = &lcd_frames[lcd_frame_back];
+    uint32_t *pending = lcd_frame_pending[lcd_frame_back];
+    uint_fast8_t i, top = 240, bottom = 0;
+
+    if(!mem.ram.block) {
+        return;
+    }
+
+    /* Catch changes made behind our back, e.g. from the debugger */
+    if (drawnControl != lcd.control || drawnBase != lcd.upcurr) {
+        drawnControl = lcd.control;
+        drawnBase = lcd.upcurr;
+        lcd_dirty_window();
+    }
+    if (memcmp(drawnPalette, lcd.palette, sizeof(drawnPalette))) {
+        memcpy(drawnPalette, lcd.palette, sizeof(drawnPalette));
+        lcd_dirty.all = true;
+    }
+    if (lcd_dirty.all || !lcd_dirty.size) {
+        lcd_dirty.all = false;
+        memset(lcd_dirty.rows, 0xFF, sizeof(lcd_dirty.rows));
+    }
+
+    for (i = 0; i < 8; i++) {
+        lcd_frame_pending[0][i] |= lcd_dirty.rows[i];
+        lcd_frame_pending[1][i] |= lcd_dirty.rows[i];
+        lcd_frame_pending[2][i] |= lcd_dirty.rows[i];
+    }
+    for (i = 0; i < 240; i++) {
+        if (lcd_dirty.rows[i >> 5] & (1u << (i & 31))) {
+            if (top == 240) {
+                top = i;
             }
-            do {
-                lcd_bgr16out((word << 4 & 0xF000) | (word << 3 & 0x780) | (word << 1 & 0x1E), rgb, &out);
-                word >>= 16;
-                words--;
-            } while (--i != 0);
-        } while (words != 0);
+            bottom = i + 1;
+        }
     }
+    memset(lcd_dirty.rows, 0, sizeof(lcd_dirty.rows));
+
+    lcd_convert_rows(frame->pixels, &lcd, 256, pending);
+    memset(pending, 0, sizeof(lcd_frame_pending[0]));
+
+    frame->seq = lcd_frame_count + 1;
+    frame->brightness = backlight.brightness;
+    frame->dirty.x = 0;
+    frame->dirty.y = top == 240 ? 0 : top;
+    frame->dirty.width = top == 240 ? 0 : 320;
+    frame->dirty.height = top == 240 ? 0 : bottom - top;
+
+    lcd_frame_last = lcd_frame_back;
+    lcd_frame_back = lcd_atomic_exchange(&lcd_frame_ready, lcd_frame_back | LCD_FRAME_FRESH) & 3;
+    lcd_atomic_exchange(&lcd_frame_count, frame->seq);
 }
 
-static void lcd_event(int index) {
-    int pcd = 1;
-    int htime, vtime;
+const lcd_frame_t *lcd_frame_acquire(void) {
+    if (lcd_atomic_load(&lcd_frame_ready) & LCD_FRAME_FRESH) {
+        lcd_frame_front = lcd_atomic_exchange(&lcd_frame_ready, lcd_frame_front) & 3;
+    }
+    return &lcd_frames[lcd_frame_front];
+}
+
+/* Readers may have picked this slot up, but it is not written again until after the next frame */
+const lcd_frame_t *lcd_frame_published(void) {
+    return &lcd_frames[lcd_frame_last];
+}
+
+uint32_t lcd_frame_seq(void) {
+    return lcd_atomic_load(&lcd_frame_count);
+}
+
+void lcd_frame_redraw(void) {
+    lcd_frame_publish();
+}
+
+/* Length of one refresh in CLOCK_12M ticks, from the programmed panel timings */
+static uint32_t lcd_frame_ticks(void) {
+    uint32_t pcd = 1;
+    uint32_t htime, vtime;
 
     if (!(lcd.timing[2] & (1 << 26))) {
         pcd = (lcd.timing[2] >> 27 << 5) + (lcd.timing[2] & 0x1F) + 2;
@@ -160,15 +781,37 @@ static void lcd_event(int index) {
             + (lcd.timing[1] >> 16 & 0x0FF)      /* Front porch   */
             + (lcd.timing[1] >> 10 & 0x03F) + 1  /* Sync pulse    */
             + (lcd.timing[1]       & 0x3FF) + 1; /* Active        */
-    event_repeat(index, pcd * htime * vtime);
+    return pcd * htime * vtime;
+}
+
+uint32_t lcd_frame_period(void) {
+    if (!sched.clockRates[CLOCK_12M]) {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)lcd_frame_ticks() * 1000000 / sched.clockRates[CLOCK_12M]);
+}
+
+static void lcd_event(int index) {
+    event_repeat(index, lcd_frame_ticks());
 
     /* For now, assuming vcomp occurs at same time UPBASE is loaded */
-    lcd.upcurr = lcd.upbase;
+    if (lcd.upcurr != lcd.upbase) {
+        lcd.upcurr = lcd.upbase;
+        lcd_dirty_window();
+    }
     lcd.ris |= 0xC;
     intrpt_set(INT_LCD, lcd.ris & lcd.mis);
 
+    lcd_frame_publish();
+    lcd_stream_frame(lcd_frame_published());
+    shm_export_frame(lcd_frame_published());
+    lcd_hash_frame(lcd_frame_published());
+
+    perf_frame();
     if (lcd_event_gui_callback) {
+        uint32_t host = perf_host_switch(PERF_HOST_GUI);
         lcd_event_gui_callback();
+        perf_host_switch(host);
     }
 }
 
@@ -178,6 +821,7 @@ void lcd_reset(void) {
     sched.items[SCHED_LCD].clock = CLOCK_12M;
     sched.items[SCHED_LCD].second = -1;
     sched.items[SCHED_LCD].proc = lcd_event;
+    lcd_dirty_window();
     gui_console_printf("[CEmu] LCD reset.\n");
 }
 
@@ -232,6 +876,7 @@ void lcd_write(const uint16_t pio, const uint8_t value) {
                 gui_console_printf("[CEmu] Warning: LCD upper panel base not 8-byte aligned\n");
             }
             lcd.upbase &= ~7U;
+            lcd_dirty.all = true;
         } else if (index < 0x018 && index >= 0x014) {
             write8(lcd.lpbase, bit_offset, value);
             if (lcd.lpbase & 7) {
@@ -244,6 +889,7 @@ void lcd_write(const uint16_t pio, const uint8_t value) {
                 else { event_clear(SCHED_LCD); }
             }
             write8(lcd.control, bit_offset, value);
+            lcd_dirty_window();
         } else if (index == 0x01C) {
             write8(lcd.imsc, bit_offset, value);
             lcd.imsc &= 0x1E;
@@ -254,6 +900,7 @@ void lcd_write(const uint16_t pio, const uint8_t value) {
         }
     } else if (index < 0x400) {
         write8(lcd.palette[pio >> 1 & 0xFF], (pio & 1) << 3, value);
+        lcd_dirty.all = true;
     } else if (index < 0xC30) {
         if(index < 0xC00 && index >= 0x800) {
             write8(lcd.crsrImage[((pio-0x800) & 0x3FF) >> 2], bit_offset, value);
@@ -303,5 +950,6 @@ bool lcd_save(emu_image *s) {
 
 bool lcd_restore(const emu_image *s) {
     lcd = s->lcd;
+    lcd_dirty_window();
     return true;
 }
@@ -7,9 +7,6 @@ extern "C" {
 
 #include "apb.h"
 
-/* Internal Use */
-extern uint32_t lcd_framebuffer[320*240];
-
 /* Standard LCD state */
 PACK(typedef struct lcd_cntrl_state {
     uint32_t timing[4];
@@ -47,6 +44,31 @@ PACK(typedef struct lcd_cntrl_state {
 /* Global LCD state */
 extern lcd_state_t lcd;
 
+/* Scanlines of the upcurr window written since they were last converted */
+typedef struct lcd_dirty_state {
+    uint32_t start;         /* RAM offset of the window */
+    uint32_t size;          /* Size of the window in bytes, 0 if it is not tracked */
+    uint32_t rowBytes;      /* Bytes of VRAM per scanline in the current mode */
+    uint32_t rows[8];       /* One bit per scanline */
+    bool all;               /* Everything has to be converted again */
+} lcd_dirty_state_t;
+
+extern lcd_dirty_state_t lcd_dirty;
+
+/* Region of a frame */
+typedef struct lcd_rect {
+    uint32_t x, y;
+    uint32_t width, height;
+} lcd_rect_t;
+
+/* A frame converted at vcomp */
+typedef struct lcd_frame {
+    uint32_t pixels[320*240];   /* RGBA8888, not dimmed */
+    uint32_t seq;               /* Number of the emulated frame, 0 if none was produced yet */
+    uint8_t brightness;         /* Backlight level at the time */
+    lcd_rect_t dirty;           /* Part that differs from frame seq - 1 */
+} lcd_frame_t;
+
 /* Available Functions */
 void lcd_reset(void);
 eZ80portrange_t init_lcd(void);
@@ -54,6 +76,24 @@ eZ80portrange_t init_lcd(void);
 void lcd_write(const uint16_t, const uint8_t);
 uint8_t lcd_read(const uint16_t);
 void lcd_drawframe(uint32_t *out, lcd_state_t*);
+void lcd_drawframe_dimmed(uint32_t *out, lcd_state_t*, uint8_t brightness);
+/* Widen one 320 pixel row of a drawn frame by an integer factor, dimming it for the given backlight level */
+void lcd_scale_row(uint32_t *out, const uint32_t *in, uint32_t factor, uint8_t brightness);
+
+/* Latest completed frame for the one reading thread (the GUI); valid until the next call */
+const lcd_frame_t *lcd_frame_acquire(void);
+/* Frame that was just completed; only for use from lcd_event_gui_callback */
+const lcd_frame_t *lcd_frame_published(void);
+/* Number of the latest completed frame */
+uint32_t lcd_frame_seq(void);
+/* Emulated time between frames in microseconds, from the current panel timings */
+uint32_t lcd_frame_period(void);
+/* Produce a frame right away; only while the emulation thread is in the debugger or not running */
+void lcd_frame_redraw(void);
+
+/* Dirty scanline tracking; offsets are relative to the start of RAM */
+void lcd_mark_dirty(uint32_t offset, uint32_t size);
+void lcd_invalidate(void);
 
 /* Set this callback function pointer from the GUI. Called in lcd_event() */
 extern void (*lcd_event_gui_callback)(void);
@@ -0,0 +1,239 @@
+#include <string.h>
+
+#include "lcdhash.h"
+#include "emu.h"
+
+#define LCD_HASH_DMA_MASK 0x7FFFF
+
+#define LCD_HASH_P1 UINT64_C(0x9E3779B185EBCA87)
+#define LCD_HASH_P2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define LCD_HASH_P3 UINT64_C(0x165667B19E3779F9)
+
+void (*lcd_wait_gui_callback)(lcd_wait_result_t result, uint64_t hash) = NULL;
+
+/* Bits per pixel of each color mode */
+static const uint8_t lcd_hash_bpp[8] = { 1, 2, 4, 8, 16, 32, 16, 16 };
+
+/* Hash of every full scanline, for the rows that did not change since the last frame */
+static uint64_t lcd_hash_rows[240];
+static uint32_t lcd_hash_seq, lcd_hash_base, lcd_hash_mode;
+static uint64_t lcd_hash_last;
+
+static struct {
+    bool active;
+    lcd_wait_t wait;
+    uint64_t start;         /* Hash when the wait started */
+    uint64_t last;          /* Hash at the last frame */
+    uint32_t same;          /* Frames in a row that matched the one before */
+    uint64_t deadline;
+} lcd_wait;
+
+static inline uint64_t lcd_hash_rotl(uint64_t x, int r) {
+    return x << r | x >> (64 - r);
+}
+
+static inline uint64_t lcd_hash_read(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t lcd_hash_avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= LCD_HASH_P2;
+    h ^= h >> 29;
+    h *= LCD_HASH_P3;
+    h ^= h >> 32;
+    return h;
+}
+
+/* Two independent lanes of multiply-rotate rounds, so a scanline takes well under a cycle per byte */
+static uint64_t lcd_hash_bytes(const uint8_t *p, uint32_t size) {
+    uint64_t a = LCD_HASH_P1, b = LCD_HASH_P2, h;
+    uint32_t n = size;
+
+    for (; n >= 16; n -= 16, p += 16) {
+        a = lcd_hash_rotl(a + lcd_hash_read(p) * LCD_HASH_P2, 31) * LCD_HASH_P1;
+        b = lcd_hash_rotl(b + lcd_hash_read(p + 8) * LCD_HASH_P2, 31) * LCD_HASH_P1;
+    }
+    h = lcd_hash_rotl(a, 7) + lcd_hash_rotl(b, 12) + size;
+    for (; n; n--, p++) {
+        h = lcd_hash_rotl(h ^ (*p * LCD_HASH_P3), 11) * LCD_HASH_P1;
+    }
+    return lcd_hash_avalanche(h);
+}
+
+/* Hash part of a scanline, going through a copy if it wraps the DMA window or runs off the end of RAM */
+static uint64_t lcd_hash_row(uint32_t ofs, uint32_t size) {
+    ALIGNED_(32) uint8_t row[1280];
+    uint32_t start = ofs & LCD_HASH_DMA_MASK;
+    uint32_t i;
+
+    if (start + size <= ram_size) {
+        return lcd_hash_bytes(mem.ram.block + start, size);
+    }
+    for (i = 0; i < size; i++) {
+        uint32_t addr = (ofs + i) & LCD_HASH_DMA_MASK;
+        row[i] = addr < ram_size ? mem.ram.block[addr] : 0;
+    }
+    return lcd_hash_bytes(row, size);
+}
+
+static uint64_t lcd_hash_combine(uint64_t h, uint64_t row) {
+    return lcd_hash_rotl(h ^ row, 27) * LCD_HASH_P1 + LCD_HASH_P3;
+}
+
+/* Fold in what decides how the bytes turn into colors */
+static uint64_t lcd_hash_finish(uint64_t h) {
+    uint32_t mode = lcd.control >> 1 & 7;
+
+    h = lcd_hash_combine(h, lcd.control & 0x70E);
+    if (mode < 4) {
+        h = lcd_hash_combine(h, lcd_hash_bytes((const uint8_t *)lcd.palette, 2 << lcd_hash_bpp[mode]));
+    }
+    h = lcd_hash_avalanche(h);
+    return h ? h : 1;
+}
+
+static bool lcd_hash_off(void) {
+    return !mem.ram.block || !(lcd.control & 0x800);
+}
+
+static bool lcd_hash_full(const lcd_rect_t *rect) {
+    return !rect->width || !rect->height || (rect->x == 0 && rect->y == 0 && rect->width >= 320 && rect->height >= 240);
+}
+
+uint64_t lcd_hash_rect(const lcd_rect_t *rect) {
+    uint32_t bpp = lcd_hash_bpp[lcd.control >> 1 & 7];
+    uint32_t bytes = 40 * bpp;
+    uint32_t x, y, width, height, first, last;
+    uint32_t ofs = lcd.upcurr & ~7;
+    uint64_t h = 0;
+
+    if (lcd_hash_off()) {
+        return 0;
+    }
+
+    if (lcd_hash_full(rect)) {
+        x = y = 0;
+        width = 320;
+        height = 240;
+    } else {
+        x = rect->x < 320 ? rect->x : 320;
+        y = rect->y < 240 ? rect->y : 240;
+        width = rect->width < 320 - x ? rect->width : 320 - x;
+        height = rect->height < 240 - y ? rect->height : 240 - y;
+    }
+
+    first = x * bpp / 8;
+    last = ((x + width) * bpp + 7) / 8;
+    for (ofs += y * bytes; height; height--, ofs += bytes) {
+        h = lcd_hash_combine(h, lcd_hash_row(ofs + first, last - first));
+    }
+    return lcd_hash_finish(h);
+}
+
+uint64_t lcd_hash_screen(void) {
+    return lcd_hash_last;
+}
+
+/* Only the scanlines the frame says changed need hashing again, unless a frame went by without us */
+static uint64_t lcd_hash_update(const lcd_frame_t *frame) {
+    uint32_t mode = lcd.control >> 1 & 7;
+    uint32_t bytes = 40 * lcd_hash_bpp[mode];
+    uint32_t base = lcd.upcurr & ~7;
+    uint32_t y, top = frame->dirty.y, bottom = frame->dirty.y + frame->dirty.height;
+    uint64_t h = 0;
+
+    if (frame->seq != lcd_hash_seq + 1 || base != lcd_hash_base || mode != lcd_hash_mode) {
+        top = 0;
+        bottom = 240;
+    }
+    lcd_hash_seq = frame->seq;
+    lcd_hash_base = base;
+    lcd_hash_mode = mode;
+
+    for (y = top; y < bottom; y++) {
+        lcd_hash_rows[y] = lcd_hash_row(base + y * bytes, bytes);
+    }
+    for (y = 0; y < 240; y++) {
+        h = lcd_hash_combine(h, lcd_hash_rows[y]);
+    }
+    return lcd_hash_finish(h);
+}
+
+static void lcd_wait_end(lcd_wait_result_t result, uint64_t hash) {
+    lcd_wait.active = false;
+    if (lcd_wait_gui_callback) {
+        lcd_wait_gui_callback(result, hash);
+    }
+}
+
+bool lcd_wait_start(const lcd_wait_t *wait) {
+    if (lcd_wait.active) {
+        lcd_wait_cancel();
+    }
+    if (wait->kind == LCD_WAIT_STABLE && !wait->frames) {
+        return false;
+    }
+
+    lcd_wait.wait = *wait;
+    lcd_wait.start = lcd_wait.last = lcd_hash_rect(&wait->rect);
+    lcd_wait.same = 0;
+    lcd_wait.deadline = wait->timeout ? sched_total_cycles() + wait->timeout : 0;
+    lcd_wait.active = true;
+
+    /* Nothing to wait for if the screen already shows it */
+    if (wait->kind == LCD_WAIT_HASH && lcd_wait.start == wait->hash) {
+        lcd_wait_end(LCD_WAIT_MET, lcd_wait.start);
+    }
+    return true;
+}
+
+void lcd_wait_cancel(void) {
+    if (lcd_wait.active) {
+        lcd_wait_end(LCD_WAIT_CANCELLED, lcd_wait.last);
+    }
+}
+
+bool lcd_wait_active(void) {
+    return lcd_wait.active;
+}
+
+void lcd_wait_poll(void) {
+    if (lcd_wait.active && lcd_wait.deadline && sched_total_cycles() >= lcd_wait.deadline) {
+        lcd_wait_end(LCD_WAIT_TIMEOUT, lcd_wait.last);
+    }
+}
+
+void lcd_hash_frame(const lcd_frame_t *frame) {
+    uint64_t hash;
+    bool met = false;
+
+    lcd_hash_last = lcd_hash_off() ? 0 : lcd_hash_update(frame);
+    if (!lcd_wait.active) {
+        return;
+    }
+
+    hash = lcd_hash_full(&lcd_wait.wait.rect) ? lcd_hash_last : lcd_hash_rect(&lcd_wait.wait.rect);
+    lcd_wait.same = hash == lcd_wait.last ? lcd_wait.same + 1 : 0;
+    lcd_wait.last = hash;
+
+    switch (lcd_wait.wait.kind) {
+        case LCD_WAIT_HASH:
+            met = hash == lcd_wait.wait.hash;
+            break;
+        case LCD_WAIT_CHANGE:
+            met = hash != lcd_wait.start;
+            break;
+        case LCD_WAIT_STABLE:
+            met = lcd_wait.same >= lcd_wait.wait.frames;
+            break;
+    }
+
+    if (met) {
+        lcd_wait_end(LCD_WAIT_MET, hash);
+    } else {
+        lcd_wait_poll();
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef LCDHASH_H
+#define LCDHASH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd.h"
+
+/*
+ * Screen hashes are taken over the VRAM bytes the panel scans out, mixed with the color mode and, for the
+ * paletted modes, the palette. A region covers the bytes of its scanlines that hold its pixels, rounded out
+ * to whole bytes in the modes below 8bpp. A screen that is switched off hashes to 0.
+ */
+
+/* What a wait is for */
+typedef enum {
+    LCD_WAIT_HASH,      /* The region hashes to a given value */
+    LCD_WAIT_CHANGE,    /* The region differs from what it was when the wait started */
+    LCD_WAIT_STABLE     /* The region stayed the same for a number of frames */
+} lcd_wait_kind_t;
+
+typedef enum {
+    LCD_WAIT_MET,
+    LCD_WAIT_TIMEOUT,
+    LCD_WAIT_CANCELLED
+} lcd_wait_result_t;
+
+typedef struct lcd_wait {
+    lcd_wait_kind_t kind;
+    lcd_rect_t rect;        /* Region to watch; an empty one means the whole screen */
+    uint64_t hash;          /* Hash to wait for */
+    uint32_t frames;        /* Frames the region has to stay unchanged */
+    uint64_t timeout;       /* Give up after this many emulated CPU cycles, 0 to wait forever */
+} lcd_wait_t;
+
+/* Hash of the whole screen as of the last frame */
+uint64_t lcd_hash_screen(void);
+/* Hash of a region of what is in VRAM right now; only from the emulation thread */
+uint64_t lcd_hash_rect(const lcd_rect_t *rect);
+
+/* Start waiting, replacing any wait already running; only from the emulation thread */
+bool lcd_wait_start(const lcd_wait_t *wait);
+void lcd_wait_cancel(void);
+bool lcd_wait_active(void);
+
+/* Hash the frame and check the wait; called from lcd_event() */
+void lcd_hash_frame(const lcd_frame_t *frame);
+/* Check the wait for a timeout; called regularly even when the panel is not refreshing */
+void lcd_wait_poll(void);
+
+/* Set this callback function pointer from the GUI. Called when a wait ends, with the hash of its region */
+extern void (*lcd_wait_gui_callback)(lcd_wait_result_t result, uint64_t hash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
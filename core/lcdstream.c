@@ -0,0 +1,222 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "lcdstream.h"
+#include "emu.h"
+#include "os/os.h"
+
+#define LCD_STREAM_PIXELS (320 * 240)
+#define LCD_STREAM_SLOTS  32  /* About half a second of frames at the usual refresh rate */
+#define LCD_STREAM_BATCH  4   /* Frames gathered into a single write */
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define lcd_stream_load(ptr) ((uint32_t)InterlockedCompareExchange((volatile LONG *)(ptr), 0, 0))
+#define lcd_stream_store(ptr, value) InterlockedExchange((volatile LONG *)(ptr), (LONG)(value))
+#define lcd_stream_release(ptr) ((uint32_t)InterlockedDecrement((volatile LONG *)(ptr)))
+#else
+#define lcd_stream_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define lcd_stream_store(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define lcd_stream_release(ptr) __atomic_sub_fetch((ptr), 1, __ATOMIC_ACQ_REL)
+#endif
+
+/*
+ * The emulation thread copies each frame into the next free slot and never waits; when the writer thread has
+ * fallen behind far enough that no slot is free, the frame is counted as dropped. The writer converts frames to
+ * the output format and writes them in batches. Both threads hold a reference and the last one out frees it.
+ */
+typedef struct lcd_stream {
+    char *path;
+    lcd_stream_format_t format;
+    uint32_t rate, scale;
+    uint32_t (*slots)[LCD_STREAM_PIXELS];
+    uint32_t head;
+    uint32_t tail;
+    uint32_t opened;
+    uint32_t stop;
+    uint32_t failed;
+    uint32_t refs;
+    uint32_t dropped;
+    os_thread_t *thread;
+} lcd_stream_t;
+
+static lcd_stream_t *lcd_stream = NULL;
+
+static void lcd_stream_unref(lcd_stream_t *stream) {
+    if (!lcd_stream_release(&stream->refs)) {
+        free(stream->slots);
+        free(stream->path);
+        free(stream);
+    }
+}
+
+static size_t lcd_stream_frame_size(lcd_stream_format_t format) {
+    return format == LCD_STREAM_Y4M ? 6 + LCD_STREAM_PIXELS * 3 : LCD_STREAM_PIXELS * 2;
+}
+
+static uint8_t *lcd_stream_convert(uint8_t *out, const uint32_t *in, lcd_stream_format_t format) {
+    uint_fast32_t i;
+
+    if (format == LCD_STREAM_Y4M) {
+        uint8_t *y = out + 6, *u = y + LCD_STREAM_PIXELS, *v = u + LCD_STREAM_PIXELS;
+        memcpy(out, "FRAME\n", 6);
+        for (i = 0; i < LCD_STREAM_PIXELS; i++) {
+            int r = in[i] & 0xFF, g = in[i] >> 8 & 0xFF, b = in[i] >> 16 & 0xFF;
+            y[i] = (( 66 * r + 129 * g +  25 * b + 128) >> 8) + 16;
+            u[i] = ((-38 * r -  74 * g + 112 * b + 128) >> 8) + 128;
+            v[i] = ((112 * r -  94 * g -  18 * b + 128) >> 8) + 128;
+        }
+    } else {
+        /* The core expands 5:6:5 by repeating the top bits, so truncating gets the original value back */
+        for (i = 0; i < LCD_STREAM_PIXELS; i++) {
+            uint32_t c = in[i];
+            uint16_t rgb565 = (c >> 3 & 0x1F) << 11 | (c >> 10 & 0x3F) << 5 | (c >> 19 & 0x1F);
+            out[i * 2] = rgb565 & 0xFF;
+            out[i * 2 + 1] = rgb565 >> 8;
+        }
+    }
+
+    return out + lcd_stream_frame_size(format);
+}
+
+static void lcd_stream_writer(void *arg) {
+    lcd_stream_t *stream = arg;
+    size_t frame_size = lcd_stream_frame_size(stream->format);
+    uint8_t *batch = malloc(frame_size * LCD_STREAM_BATCH);
+    uint8_t *pos = batch;
+    FILE *file;
+
+    /* Opening a named pipe blocks until something reads from it */
+    file = fopen_utf8(stream->path, "wb");
+    lcd_stream_store(&stream->opened, 1);
+
+    if (!file || !batch) {
+        lcd_stream_store(&stream->failed, 1);
+    } else {
+        setvbuf(file, NULL, _IONBF, 0);
+        if (stream->format == LCD_STREAM_Y4M) {
+            fprintf(file, "YUV4MPEG2 W320 H240 F%u:%u Ip A1:1 C444\n", stream->rate, stream->scale);
+        }
+
+        for (;;) {
+            uint32_t tail = stream->tail;
+            bool idle = tail == lcd_stream_load(&stream->head);
+
+            if (!idle) {
+                pos = lcd_stream_convert(pos, stream->slots[tail % LCD_STREAM_SLOTS], stream->format);
+                lcd_stream_store(&stream->tail, tail + 1);
+            }
+            if (pos != batch && (idle || pos == batch + frame_size * LCD_STREAM_BATCH)) {
+                if (fwrite(batch, 1, pos - batch, file) != (size_t)(pos - batch)) {
+                    lcd_stream_store(&stream->failed, 1);
+                    break;
+                }
+                pos = batch;
+            }
+            if (idle) {
+                if (lcd_stream_load(&stream->stop)) {
+                    break;
+                }
+                os_sleep_ms(2);
+            }
+        }
+    }
+
+    if (file && fclose(file)) {
+        lcd_stream_store(&stream->failed, 1);
+    }
+    free(batch);
+    lcd_stream_unref(stream);
+}
+
+bool lcd_stream_start(const char *path, lcd_stream_format_t format) {
+    lcd_stream_t *stream;
+    uint32_t period;
+    size_t length;
+
+    lcd_stream_stop();
+
+    stream = calloc(1, sizeof(lcd_stream_t));
+    if (!stream) {
+        return false;
+    }
+
+    length = strlen(path) + 1;
+    stream->path = malloc(length);
+    stream->slots = malloc(LCD_STREAM_SLOTS * sizeof(*stream->slots));
+    if (!stream->path || !stream->slots) {
+        free(stream->path);
+        free(stream->slots);
+        free(stream);
+        return false;
+    }
+    memcpy(stream->path, path, length);
+
+    stream->format = format;
+    period = lcd_frame_period();
+    stream->rate = period ? 1000000 : 60;
+    stream->scale = period ? period : 1;
+    stream->refs = 2;
+
+    stream->thread = os_thread_start(lcd_stream_writer, stream);
+    if (!stream->thread) {
+        free(stream->path);
+        free(stream->slots);
+        free(stream);
+        return false;
+    }
+
+    lcd_stream = stream;
+    gui_console_printf("[CEmu] Streaming frames to %s.\n", path);
+    return true;
+}
+
+bool lcd_stream_stop(void) {
+    lcd_stream_t *stream = lcd_stream;
+    bool success;
+
+    if (!stream) {
+        return false;
+    }
+
+    lcd_stream = NULL;
+    lcd_stream_store(&stream->stop, 1);
+
+    if (!lcd_stream_load(&stream->opened)) {
+        /* Still waiting for a reader on a pipe; the writer finishes up on its own if one ever shows up */
+        os_thread_detach(stream->thread);
+        lcd_stream_unref(stream);
+        gui_console_printf("[CEmu] Frame stream stopped before anything was reading it.\n");
+        return false;
+    }
+
+    os_thread_join(stream->thread);
+    success = !stream->failed;
+    if (stream->dropped) {
+        gui_console_printf("[CEmu] Frame stream fell behind, %u frames were dropped.\n", stream->dropped);
+    }
+    lcd_stream_unref(stream);
+    return success;
+}
+
+bool lcd_stream_active(void) {
+    return lcd_stream != NULL;
+}
+
+void lcd_stream_frame(const lcd_frame_t *frame) {
+    lcd_stream_t *stream = lcd_stream;
+    uint32_t head;
+
+    if (!stream) {
+        return;
+    }
+
+    head = stream->head;
+    if (head - lcd_stream_load(&stream->tail) >= LCD_STREAM_SLOTS) {
+        stream->dropped++;
+        return;
+    }
+
+    memcpy(stream->slots[head % LCD_STREAM_SLOTS], frame->pixels, sizeof(*stream->slots));
+    lcd_stream_store(&stream->head, head + 1);
+}
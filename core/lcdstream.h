@@ -0,0 +1,31 @@
+#ifndef LCDSTREAM_H
+#define LCDSTREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd.h"
+
+/* Every completed frame, uncompressed, for piping into an encoder or analysis tool */
+typedef enum {
+    LCD_STREAM_RGB565,  /* Raw little-endian RGB565, 320x240, no header */
+    LCD_STREAM_Y4M      /* YUV4MPEG2, 4:4:4 BT.601, frame rate taken from the panel timings */
+} lcd_stream_format_t;
+
+/* Start or stop streaming; call from the emulation thread or while it is not running */
+bool lcd_stream_start(const char *path, lcd_stream_format_t format);
+bool lcd_stream_stop(void);
+bool lcd_stream_active(void);
+
+/* Queue a frame; called from lcd_event() */
+void lcd_stream_frame(const lcd_frame_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
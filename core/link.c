@@ -5,6 +5,7 @@
 #include "asic.h"
 #include "emu.h"
 #include "os/os.h"
+#include "debug/disasm.h"
 
 volatile bool emu_is_sending = false;
 volatile bool emu_is_recieving = false;
@@ -172,6 +173,7 @@ bool sendVariableLink(const char *var_name) {
 
     if (fseek(file, 0x48, 0))                           goto r_err;
     if (fread(var_ptr, 1, var_size, file) != var_size)  goto r_err;
+    lcd_invalidate();
 
     if (var_arc == 0x80) {
         cpu.halted = cpu.IEF_wait = 0;
@@ -189,12 +191,18 @@ bool sendVariableLink(const char *var_name) {
     cpu.next = 2000000;
     cpu_execute();
 
+#ifdef DEBUG_SUPPORT
+    disasm_cache_flush();
+#endif
     cpu.cycles = save_cycles;
     cpu.next = save_next;
 
     return !fclose(file);
 
 r_err:
+#ifdef DEBUG_SUPPORT
+    disasm_cache_flush();
+#endif
     cpu.cycles = save_cycles;
     cpu.next = save_next;
     fclose(file);
@@ -6,6 +6,9 @@
 #include "cpu.h"
 #include "flash.h"
 #include "control.h"
+#include "perf.h"
+#include "debug/disasm.h"
+#include "debug/trace.h"
 
 /* Global MEMORY state */
 mem_state_t mem;
@@ -53,21 +56,32 @@ void mem_free(void) {
 void mem_reset(void) {
     memset(mem.ram.block, 0, ram_size);
     memset(mem.flash.block, 0, flash_size);
+    lcd_invalidate();
+#ifdef DEBUG_SUPPORT
+    disasm_cache_flush();
+#endif
     gui_console_printf("[CEmu] Memory Reset.\n");
 }
 
+static const uint8_t mmio_readcycles[0x20] = {2,2,4,3,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,2};
+static const uint8_t mmio_writecycles[0x20] = {2,2,4,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,2};
+
+static uint32_t flash_cycles(uint32_t address) {
+    return address > flash.mask || !flash.mapped ? 258 : 6 + flash.addedWaitStates;
+}
+
 static uint32_t flash_address(uint32_t address, uint32_t *size) {
     uint32_t mask = flash.mask;
     if (size) {
         *size = mask + 1;
+    } else {
+        uint32_t cycles = flash_cycles(address);
+        cpu.cycles += cycles;
+        perf.flash_accesses++;
+        perf.flash_cycles += cycles;
     }
     if (address > mask || !flash.mapped)  {
         address &= mask;
-        if (!size) {
-            cpu.cycles += 258;
-        }
-    } else if (!size) {
-        cpu.cycles += 6 + flash.addedWaitStates;
     }
     return address;
 }
@@ -90,6 +104,39 @@ uint8_t *phys_mem_ptr(uint32_t address, uint32_t size) {
     return NULL;
 }
 
+uint8_t *phys_mem_span(uint32_t address, uint32_t *size) {
+    uint8_t *ptr = NULL;
+    uint32_t avail;
+
+    address &= 0xFFFFFF;
+    if (address < 0xD00000) {
+        uint32_t block_size, offset = flash_address(address, &block_size);
+        /* Contiguous until the end of the region or the point where the flash mirror wraps around */
+        avail = block_size - offset;
+        if (avail > 0xD00000 - address) {
+            avail = 0xD00000 - address;
+        }
+        if (mem.flash.block && offset < flash_size) {
+            ptr = mem.flash.block + offset;
+            if (avail > flash_size - offset) {
+                avail = flash_size - offset;
+            }
+        }
+    } else if (address < 0xD00000 + ram_size) {
+        avail = 0xD00000 + ram_size - address;
+        if (mem.ram.block) {
+            ptr = mem.ram.block + (address - 0xD00000);
+        }
+    } else {
+        avail = (address < 0xE00000 ? 0xE00000 : 0x1000000) - address;
+    }
+
+    if (*size > avail) {
+        *size = avail;
+    }
+    return ptr;
+}
+
 static void flash_reset_write_index(uint32_t addr, uint8_t byte) {
     (void)addr;
     (void)byte;
@@ -338,8 +385,22 @@ static void flash_write_handler(uint32_t address, uint8_t byte) {
     }
 }
 
+uint32_t mem_access_cycles(uint32_t address, bool write) {
+    address &= 0xFFFFFF;
+    switch((address >> 20) & 0xF) {
+        case 0x0: case 0x1: case 0x2: case 0x3:
+        case 0x4: case 0x5: case 0x6: case 0x7:
+            return flash_cycles(address);
+        case 0xD:
+            return write ? 2 : 4;
+        case 0xE: case 0xF:
+            return (write ? mmio_writecycles : mmio_readcycles)[(address >> 16) & 0x1F];
+        default:
+            return 258;
+    }
+}
+
 uint8_t mem_read_byte(uint32_t address) {
-    static const uint8_t mmio_readcycles[0x20] = {2,2,4,3,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,2};
     uint8_t value = 0;
     uint32_t ramAddress;
 
@@ -380,7 +441,6 @@ uint8_t mem_read_byte(uint32_t address) {
 }
 
 void mem_write_byte(uint32_t address, uint8_t value) {
-    static const uint8_t mmio_writecycles[0x20] = {2,2,4,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,2};
     uint32_t ramAddress;
     address &= 0xFFFFFF;
 
@@ -406,6 +466,9 @@ void mem_write_byte(uint32_t address, uint8_t value) {
             ramAddress = address & 0x7FFFF;
             if (ramAddress < 0x65800) {
                 mem.ram.block[ramAddress] = value;
+                if (ramAddress - lcd_dirty.start < lcd_dirty.size) {
+                    lcd_mark_dirty(ramAddress, 1);
+                }
             }
             break;
 
@@ -439,6 +502,10 @@ void mem_write_byte(uint32_t address, uint8_t value) {
             break;
     }
 #ifdef DEBUG_SUPPORT
+    disasm_cache_write(address);
+    if (trace.writes && trace.active) {
+        trace_write(address, value);
+    }
     if ((debugger.data.block[address] &= ~(DBG_INST_START_MARKER | DBG_INST_MARKER)) & DBG_WRITE_BREAKPOINT) {
         open_debugger(HIT_WRITE_BREAKPOINT, address);
     }
@@ -473,6 +540,10 @@ bool mem_restore(const emu_image *s) {
 
     memcpy(mem.flash.block, s->mem_flash, flash_size);
     memcpy(mem.ram.block, s->mem_ram, ram_size);
+    lcd_invalidate();
+#ifdef DEBUG_SUPPORT
+    disasm_cache_flush();
+#endif
 
     for (i = 0; i < 8; i++) {
         mem.flash.sector[i].ptr = mem.flash.block + (i*flash_sector_size_8K);
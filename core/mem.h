@@ -70,8 +70,12 @@ void mem_free(void);
 void mem_reset(void);
 
 uint8_t *phys_mem_ptr(uint32_t address, uint32_t size);
+/* Memory backing address onwards; size is cut down to the bytes that follow on in the same block. NULL if unmapped */
+uint8_t *phys_mem_span(uint32_t address, uint32_t *size);
 uint8_t mem_read_byte(uint32_t address);
 void mem_write_byte(uint32_t address, uint8_t value);
+/* Cycles mem_read_byte() or mem_write_byte() would take at address, without doing it */
+uint32_t mem_access_cycles(uint32_t address, bool write);
 
 /* Save/Restore */
 typedef struct emu_image emu_image;
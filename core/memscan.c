@@ -0,0 +1,552 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memscan.h"
+#include "mem.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MEM_SCAN_SIMD_X86
+#define MEM_SCAN_TARGET_SSE2 __attribute__((target("sse2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define MEM_SCAN_SIMD_SSE2_ONLY
+#define MEM_SCAN_TARGET_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define MEM_SCAN_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/* Candidates are kept in chunks of 4096 offsets; a chunk with none or all of them left needs no bits */
+#define MEM_SCAN_CHUNK_WORDS 64
+#define MEM_SCAN_CHUNK_SIZE  (MEM_SCAN_CHUNK_WORDS * 64)
+
+typedef struct mem_scan_chunk {
+    uint64_t *bits;         /* Only while some but not all of the chunk is left */
+    uint32_t count;
+} mem_scan_chunk_t;
+
+typedef struct mem_scan_pass {
+    mem_scan_op_t op;
+    const uint8_t *cur;
+    const uint8_t *prev;
+    uint8_t value[MEM_SCAN_FLOAT_SIZE];
+    uint8_t mask[MEM_SCAN_FLOAT_SIZE];
+} mem_scan_pass_t;
+
+/* Bit n of each mask is for the byte at offset n */
+typedef uint64_t (*mem_scan_equal_kernel_t)(const uint8_t *a, uint8_t value, uint8_t mask);
+typedef void (*mem_scan_compare_kernel_t)(const uint8_t *a, const uint8_t *b, uint64_t *eq, uint64_t *gt);
+
+static struct {
+    bool active;
+    mem_scan_area_t area;
+    mem_scan_type_t type;
+    uint32_t width;
+    uint32_t size;
+    uint32_t base;
+    uint32_t offsets;       /* Offsets a whole value fits at */
+    uint8_t *prev;          /* Snapshot from the last pass */
+    uint32_t chunks;
+    mem_scan_chunk_t *chunk;
+    uint32_t count;
+} mem_scan;
+
+static mem_scan_equal_kernel_t mem_scan_equal = NULL;
+static mem_scan_compare_kernel_t mem_scan_compare = NULL;
+
+static inline uint32_t mem_scan_popcount(uint64_t x) {
+#ifdef _MSC_VER
+    return (uint32_t)__popcnt64(x);
+#else
+    return (uint32_t)__builtin_popcountll(x);
+#endif
+}
+
+static inline uint32_t mem_scan_ctz(uint64_t x) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return i;
+#else
+    return (uint32_t)__builtin_ctzll(x);
+#endif
+}
+
+static uint64_t mem_scan_equal_scalar(const uint8_t *a, uint8_t value, uint8_t mask) {
+    uint64_t bits = 0;
+    uint32_t i;
+    for (i = 0; i < 64; i++) {
+        bits |= (uint64_t)((a[i] & mask) == value) << i;
+    }
+    return bits;
+}
+
+static void mem_scan_compare_scalar(const uint8_t *a, const uint8_t *b, uint64_t *eq, uint64_t *gt) {
+    uint64_t e = 0, g = 0;
+    uint32_t i;
+    for (i = 0; i < 64; i++) {
+        e |= (uint64_t)(a[i] == b[i]) << i;
+        g |= (uint64_t)(a[i] > b[i]) << i;
+    }
+    *eq = e;
+    *gt = g;
+}
+
+#if defined(MEM_SCAN_SIMD_X86) || defined(MEM_SCAN_SIMD_SSE2_ONLY)
+MEM_SCAN_TARGET_SSE2 static uint64_t mem_scan_equal_sse2(const uint8_t *a, uint8_t value, uint8_t mask) {
+    __m128i v = _mm_set1_epi8((char)value), m = _mm_set1_epi8((char)mask);
+    uint64_t bits = 0;
+    uint32_t i;
+    for (i = 0; i < 4; i++) {
+        __m128i x = _mm_and_si128(_mm_loadu_si128((const __m128i *)(a + i * 16)), m);
+        bits |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, v)) << (i * 16);
+    }
+    return bits;
+}
+
+/* There is no unsigned byte compare, but a byte is at least another one when it is their maximum */
+MEM_SCAN_TARGET_SSE2 static void mem_scan_compare_sse2(const uint8_t *a, const uint8_t *b, uint64_t *eq, uint64_t *gt) {
+    uint64_t e = 0, g = 0;
+    uint32_t i;
+    for (i = 0; i < 4; i++) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(a + i * 16));
+        __m128i y = _mm_loadu_si128((const __m128i *)(b + i * 16));
+        __m128i same = _mm_cmpeq_epi8(x, y);
+        __m128i ge = _mm_cmpeq_epi8(_mm_max_epu8(x, y), x);
+        e |= (uint64_t)(uint32_t)_mm_movemask_epi8(same) << (i * 16);
+        g |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_andnot_si128(same, ge)) << (i * 16);
+    }
+    *eq = e;
+    *gt = g;
+}
+#endif
+
+#ifdef MEM_SCAN_SIMD_NEON
+static inline uint64_t mem_scan_neon_movemask(uint8x16_t v) {
+    static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t m = vandq_u8(v, vld1q_u8(weights));
+    return (uint64_t)vaddv_u8(vget_low_u8(m)) | (uint64_t)vaddv_u8(vget_high_u8(m)) << 8;
+}
+
+static uint64_t mem_scan_equal_neon(const uint8_t *a, uint8_t value, uint8_t mask) {
+    uint64_t bits = 0;
+    uint32_t i;
+    for (i = 0; i < 4; i++) {
+        uint8x16_t x = vandq_u8(vld1q_u8(a + i * 16), vdupq_n_u8(mask));
+        bits |= mem_scan_neon_movemask(vceqq_u8(x, vdupq_n_u8(value))) << (i * 16);
+    }
+    return bits;
+}
+
+static void mem_scan_compare_neon(const uint8_t *a, const uint8_t *b, uint64_t *eq, uint64_t *gt) {
+    uint64_t e = 0, g = 0;
+    uint32_t i;
+    for (i = 0; i < 4; i++) {
+        uint8x16_t x = vld1q_u8(a + i * 16), y = vld1q_u8(b + i * 16);
+        e |= mem_scan_neon_movemask(vceqq_u8(x, y)) << (i * 16);
+        g |= mem_scan_neon_movemask(vcgtq_u8(x, y)) << (i * 16);
+    }
+    *eq = e;
+    *gt = g;
+}
+#endif
+
+static void mem_scan_select_kernels(void) {
+    mem_scan_equal = mem_scan_equal_scalar;
+    mem_scan_compare = mem_scan_compare_scalar;
+#if defined(MEM_SCAN_SIMD_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) {
+        mem_scan_equal = mem_scan_equal_sse2;
+        mem_scan_compare = mem_scan_compare_sse2;
+    }
+#elif defined(MEM_SCAN_SIMD_SSE2_ONLY)
+    mem_scan_equal = mem_scan_equal_sse2;
+    mem_scan_compare = mem_scan_compare_sse2;
+#elif defined(MEM_SCAN_SIMD_NEON)
+    mem_scan_equal = mem_scan_equal_neon;
+    mem_scan_compare = mem_scan_compare_neon;
+#endif
+}
+
+uint32_t mem_scan_width(mem_scan_type_t type) {
+    switch (type) {
+        case MEM_SCAN_8:
+            return 1;
+        case MEM_SCAN_16:
+            return 2;
+        case MEM_SCAN_24:
+            return 3;
+        case MEM_SCAN_FLOAT:
+            return MEM_SCAN_FLOAT_SIZE;
+    }
+    return 1;
+}
+
+static bool mem_scan_float_zero(const uint8_t *in) {
+    uint32_t i;
+    for (i = 2; i < MEM_SCAN_FLOAT_SIZE; i++) {
+        if (in[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Real or complex part type, BCD digits only, and a leading digit unless the whole mantissa is zero */
+static bool mem_scan_float_valid(const uint8_t *in) {
+    uint32_t i, type = in[0] & 0x1F;
+
+    if (type != 0x00 && type != 0x0C) {
+        return false;
+    }
+    for (i = 2; i < MEM_SCAN_FLOAT_SIZE; i++) {
+        if ((in[i] & 0xF0) > 0x90 || (in[i] & 0x0F) > 0x09) {
+            return false;
+        }
+    }
+    return in[2] >= 0x10 || mem_scan_float_zero(in);
+}
+
+/* Normalized BCD orders like the numbers it holds, so no conversion is needed */
+static int mem_scan_float_order(const uint8_t *a, const uint8_t *b) {
+    bool za = mem_scan_float_zero(a), zb = mem_scan_float_zero(b);
+    bool na = !za && (a[0] & 0x80), nb = !zb && (b[0] & 0x80);
+    int mag;
+
+    if (na != nb) {
+        return na ? -1 : 1;
+    }
+    if (za || zb) {
+        mag = (int)zb - (int)za;
+    } else if (a[1] != b[1]) {
+        mag = a[1] > b[1] ? 1 : -1;
+    } else {
+        mag = memcmp(a + 2, b + 2, MEM_SCAN_FLOAT_SIZE - 2);
+    }
+    return na ? -mag : mag;
+}
+
+bool mem_scan_float_encode(double value, uint8_t *out) {
+    char digits[32];
+    int exponent, i;
+
+    if (!isfinite(value)) {
+        return false;
+    }
+    memset(out, 0, MEM_SCAN_FLOAT_SIZE);
+    out[1] = 0x80;
+    if (value == 0) {
+        return true;
+    }
+    if (value < 0) {
+        out[0] = 0x80;
+        value = -value;
+    }
+
+    /* "d.ddddddddddddde+x" has exactly the 14 significant digits a real keeps */
+    snprintf(digits, sizeof(digits), "%.13e", value);
+    exponent = atoi(digits + 16);
+    /* The OS keeps reals to within 1e-99 and 9.9999999999999e99 */
+    if (exponent < -99 || exponent > 99) {
+        return false;
+    }
+    out[1] = (uint8_t)(0x80 + exponent);
+    digits[1] = digits[0];
+    for (i = 0; i < 14; i++) {
+        out[2 + i / 2] |= (digits[1 + i] - '0') << (i & 1 ? 0 : 4);
+    }
+    return true;
+}
+
+bool mem_scan_float_decode(const uint8_t *in, double *value) {
+    double v = 0;
+    int exponent = in[1] - 0x80 - 13, i;
+
+    if (!mem_scan_float_valid(in)) {
+        return false;
+    }
+    for (i = 0; i < 14; i++) {
+        v = v * 10 + (in[2 + i / 2] >> (i & 1 ? 0 : 4) & 15);
+    }
+    for (; exponent > 0; exponent--) {
+        v *= 10;
+    }
+    for (; exponent < 0; exponent++) {
+        v /= 10;
+    }
+    *value = in[0] & 0x80 ? -v : v;
+    return true;
+}
+
+static uint8_t *mem_scan_data(void) {
+    return mem_scan.area == MEM_SCAN_RAM ? mem.ram.block : mem.flash.block;
+}
+
+static uint32_t mem_scan_capacity(uint32_t c) {
+    uint32_t left = mem_scan.offsets - c * MEM_SCAN_CHUNK_SIZE;
+    return left < MEM_SCAN_CHUNK_SIZE ? left : MEM_SCAN_CHUNK_SIZE;
+}
+
+bool mem_scan_start(mem_scan_area_t area, mem_scan_type_t type) {
+    uint8_t *data;
+    uint32_t c;
+
+    mem_scan_end();
+    if (!mem_scan_equal) {
+        mem_scan_select_kernels();
+    }
+
+    mem_scan.area = area;
+    mem_scan.type = type;
+    mem_scan.width = mem_scan_width(type);
+    mem_scan.size = area == MEM_SCAN_RAM ? ram_size : flash_size;
+    mem_scan.base = area == MEM_SCAN_RAM ? 0xD00000 : 0;
+    mem_scan.offsets = mem_scan.size - mem_scan.width + 1;
+    mem_scan.chunks = (mem_scan.offsets + MEM_SCAN_CHUNK_SIZE - 1) / MEM_SCAN_CHUNK_SIZE;
+
+    data = mem_scan_data();
+    if (!data) {
+        return false;
+    }
+    mem_scan.chunk = calloc(mem_scan.chunks, sizeof(mem_scan_chunk_t));
+    mem_scan.prev = malloc(mem_scan.size);
+    if (!mem_scan.chunk || !mem_scan.prev) {
+        free(mem_scan.chunk);
+        free(mem_scan.prev);
+        mem_scan.chunk = NULL;
+        mem_scan.prev = NULL;
+        return false;
+    }
+    for (c = 0; c < mem_scan.chunks; c++) {
+        mem_scan.chunk[c].count = mem_scan_capacity(c);
+    }
+    memcpy(mem_scan.prev, data, mem_scan.size);
+    mem_scan.count = mem_scan.offsets;
+    mem_scan.active = true;
+    return true;
+}
+
+void mem_scan_end(void) {
+    uint32_t c;
+
+    if (mem_scan.chunk) {
+        for (c = 0; c < mem_scan.chunks; c++) {
+            free(mem_scan.chunk[c].bits);
+        }
+    }
+    free(mem_scan.chunk);
+    free(mem_scan.prev);
+    mem_scan.chunk = NULL;
+    mem_scan.prev = NULL;
+    mem_scan.count = 0;
+    mem_scan.active = false;
+}
+
+bool mem_scan_active(void) {
+    return mem_scan.active;
+}
+
+uint32_t mem_scan_count(void) {
+    return mem_scan.count;
+}
+
+static inline uint32_t mem_scan_read(const uint8_t *p, uint32_t width) {
+    uint32_t v = 0;
+    while (width--) {
+        v = v << 8 | p[width];
+    }
+    return v;
+}
+
+/* One offset at a time, for the end of the area and for what needs a closer look at reals */
+static bool mem_scan_test(const mem_scan_pass_t *pass, uint32_t o) {
+    const uint8_t *cur = pass->cur + o, *prev = pass->prev + o;
+    uint32_t width = mem_scan.width;
+
+    if (mem_scan.type == MEM_SCAN_FLOAT) {
+        if (!mem_scan_float_valid(cur)) {
+            return false;
+        }
+        switch (pass->op) {
+            case MEM_SCAN_EQUAL:
+                return (cur[0] & 0x80) == (pass->value[0] & 0x80) && !memcmp(cur + 1, pass->value + 1, width - 1);
+            case MEM_SCAN_CHANGED:
+                return memcmp(cur, prev, width) != 0;
+            case MEM_SCAN_UNCHANGED:
+                return memcmp(cur, prev, width) == 0;
+            case MEM_SCAN_INCREASED:
+                return mem_scan_float_valid(prev) && mem_scan_float_order(cur, prev) > 0;
+            case MEM_SCAN_DECREASED:
+                return mem_scan_float_valid(prev) && mem_scan_float_order(cur, prev) < 0;
+        }
+        return false;
+    }
+
+    switch (pass->op) {
+        case MEM_SCAN_EQUAL:
+            return mem_scan_read(cur, width) == mem_scan_read(pass->value, width);
+        case MEM_SCAN_CHANGED:
+            return mem_scan_read(cur, width) != mem_scan_read(prev, width);
+        case MEM_SCAN_UNCHANGED:
+            return mem_scan_read(cur, width) == mem_scan_read(prev, width);
+        case MEM_SCAN_INCREASED:
+            return mem_scan_read(cur, width) > mem_scan_read(prev, width);
+        case MEM_SCAN_DECREASED:
+            return mem_scan_read(cur, width) < mem_scan_read(prev, width);
+    }
+    return false;
+}
+
+static uint64_t mem_scan_test_each(const mem_scan_pass_t *pass, uint32_t o, uint64_t candidates) {
+    uint64_t keep = 0;
+    while (candidates) {
+        uint32_t i = mem_scan_ctz(candidates);
+        candidates &= candidates - 1;
+        if (mem_scan_test(pass, o + i)) {
+            keep |= UINT64_C(1) << i;
+        }
+    }
+    return keep;
+}
+
+/*
+ * Which of the 64 offsets from o pass. Integers compare a byte plane at a time, most significant first for
+ * the orderings; reals only go through the vector compare for equality and leave the rest to mem_scan_test().
+ */
+static uint64_t mem_scan_word(const mem_scan_pass_t *pass, uint32_t o, uint64_t candidates) {
+    const uint8_t *cur = pass->cur + o, *prev = pass->prev + o;
+    uint32_t width = mem_scan.width, k;
+    uint64_t eq = ~UINT64_C(0), gt = 0;
+    bool real = mem_scan.type == MEM_SCAN_FLOAT;
+
+    if (o + 63 + width > mem_scan.size) {
+        return mem_scan_test_each(pass, o, candidates);
+    }
+
+    if (pass->op == MEM_SCAN_EQUAL) {
+        for (k = 0; k < width && (eq & candidates); k++) {
+            eq &= mem_scan_equal(cur + k, pass->value[k], pass->mask[k]);
+        }
+        return real ? mem_scan_test_each(pass, o, eq & candidates) : eq;
+    }
+
+    for (k = width; k-- && (eq & candidates);) {
+        uint64_t e, g;
+        mem_scan_compare(cur + k, prev + k, &e, &g);
+        gt |= eq & g;
+        eq &= e;
+    }
+    if (real) {
+        return mem_scan_test_each(pass, o, (pass->op == MEM_SCAN_UNCHANGED ? eq : ~eq) & candidates);
+    }
+    switch (pass->op) {
+        case MEM_SCAN_CHANGED:
+            return ~eq;
+        case MEM_SCAN_UNCHANGED:
+            return eq;
+        case MEM_SCAN_INCREASED:
+            return gt;
+        case MEM_SCAN_DECREASED:
+            return ~gt & ~eq;
+        default:
+            return 0;
+    }
+}
+
+uint32_t mem_scan_narrow(mem_scan_op_t op, const uint8_t *value) {
+    mem_scan_pass_t pass;
+    uint64_t out[MEM_SCAN_CHUNK_WORDS];
+    uint32_t c, j, total = 0;
+    uint8_t *data = mem_scan_data();
+
+    if (!mem_scan.active || !data) {
+        return 0;
+    }
+
+    pass.op = op;
+    pass.cur = data;
+    pass.prev = mem_scan.prev;
+    memset(pass.value, 0, sizeof(pass.value));
+    memset(pass.mask, 0xFF, sizeof(pass.mask));
+    if (op == MEM_SCAN_EQUAL) {
+        memcpy(pass.value, value, mem_scan.width);
+    }
+    if (mem_scan.type == MEM_SCAN_FLOAT) {
+        /* Only the sign of the first byte counts; the rest of it is the type */
+        pass.mask[0] = 0x80;
+        pass.value[0] &= 0x80;
+    }
+
+    for (c = 0; c < mem_scan.chunks; c++) {
+        mem_scan_chunk_t *chunk = &mem_scan.chunk[c];
+        uint32_t capacity = mem_scan_capacity(c);
+        uint32_t words = (capacity + 63) / 64;
+        uint32_t count = 0;
+
+        if (!chunk->count) {
+            continue;
+        }
+        for (j = 0; j < words; j++) {
+            uint32_t left = capacity - j * 64;
+            uint64_t candidates = chunk->bits ? chunk->bits[j] : left >= 64 ? ~UINT64_C(0) : (UINT64_C(1) << left) - 1;
+            out[j] = candidates ? mem_scan_word(&pass, c * MEM_SCAN_CHUNK_SIZE + j * 64, candidates) & candidates : 0;
+            count += mem_scan_popcount(out[j]);
+        }
+
+        if (count && count < capacity) {
+            if (!chunk->bits) {
+                chunk->bits = calloc(MEM_SCAN_CHUNK_WORDS, sizeof(uint64_t));
+            }
+            if (chunk->bits) {
+                memcpy(chunk->bits, out, words * sizeof(uint64_t));
+            } else {
+                count = 0;
+            }
+        } else {
+            free(chunk->bits);
+            chunk->bits = NULL;
+        }
+        chunk->count = count;
+        total += count;
+    }
+
+    memcpy(mem_scan.prev, data, mem_scan.size);
+    mem_scan.count = total;
+    return total;
+}
+
+uint32_t mem_scan_results(uint32_t *addresses, uint32_t max) {
+    uint32_t c, j, n = 0;
+
+    for (c = 0; c < mem_scan.chunks && n < max; c++) {
+        const mem_scan_chunk_t *chunk = &mem_scan.chunk[c];
+        uint32_t capacity = mem_scan_capacity(c);
+        uint32_t base = mem_scan.base + c * MEM_SCAN_CHUNK_SIZE;
+
+        if (!chunk->count) {
+            continue;
+        }
+        if (!chunk->bits) {
+            for (j = 0; j < capacity && n < max; j++) {
+                addresses[n++] = base + j;
+            }
+            continue;
+        }
+        for (j = 0; j < MEM_SCAN_CHUNK_WORDS && n < max; j++) {
+            uint64_t bits = chunk->bits[j];
+            while (bits && n < max) {
+                addresses[n++] = base + j * 64 + mem_scan_ctz(bits);
+                bits &= bits - 1;
+            }
+        }
+    }
+    return n;
+}
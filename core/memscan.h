@@ -0,0 +1,65 @@
+#ifndef MEMSCAN_H
+#define MEMSCAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Finds where a value lives by narrowing down a set of candidate addresses over several passes. A scan starts
+ * with every address of the area that can hold a value, and each pass keeps the ones whose value compares as
+ * asked, either against a given value or against the value it had at the pass before.
+ */
+
+#define MEM_SCAN_FLOAT_SIZE 9
+
+typedef enum {
+    MEM_SCAN_RAM,
+    MEM_SCAN_FLASH
+} mem_scan_area_t;
+
+typedef enum {
+    MEM_SCAN_8,
+    MEM_SCAN_16,
+    MEM_SCAN_24,            /* Little endian, like everything else on the eZ80 */
+    MEM_SCAN_FLOAT          /* TI real: sign and type, biased exponent, 14 BCD digits */
+} mem_scan_type_t;
+
+typedef enum {
+    MEM_SCAN_EQUAL,         /* Equal to the given value */
+    MEM_SCAN_CHANGED,       /* The rest compare against the value at the last pass */
+    MEM_SCAN_UNCHANGED,
+    MEM_SCAN_INCREASED,
+    MEM_SCAN_DECREASED
+} mem_scan_op_t;
+
+/* Start a new scan with every address as a candidate, and take the first snapshot */
+bool mem_scan_start(mem_scan_area_t area, mem_scan_type_t type);
+void mem_scan_end(void);
+bool mem_scan_active(void);
+
+/* Bytes of a value of this type */
+uint32_t mem_scan_width(mem_scan_type_t type);
+
+/*
+ * Keep the candidates that compare as asked and take a new snapshot. The value is in memory order, so little
+ * endian for integers and as encoded by mem_scan_float_encode() for reals; it is only used by MEM_SCAN_EQUAL.
+ * Returns the number of candidates left.
+ */
+uint32_t mem_scan_narrow(mem_scan_op_t op, const uint8_t *value);
+uint32_t mem_scan_count(void);
+/* Copy out up to max candidate addresses, lowest first, and return how many were copied */
+uint32_t mem_scan_results(uint32_t *addresses, uint32_t max);
+
+/* Convert to and from TI reals; decoding returns false if the bytes are not a valid real */
+bool mem_scan_float_encode(double value, uint8_t *out);
+bool mem_scan_float_decode(const uint8_t *in, double *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
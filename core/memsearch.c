@@ -0,0 +1,400 @@
+#include <string.h>
+
+#include "memsearch.h"
+#include "mem.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MEM_SEARCH_SIMD_X86
+#define MEM_SEARCH_TARGET_SSE2 __attribute__((target("sse2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define MEM_SEARCH_SIMD_SSE2_ONLY
+#define MEM_SEARCH_TARGET_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MEM_SEARCH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/* Where the ports start; reading them has side effects, so they are never searched */
+#define MEM_SEARCH_MAPPED_END 0xE00000
+
+typedef struct mem_search {
+    const mem_pattern_t *patterns;
+    uint32_t count;
+    uint32_t longest;
+    uint32_t anchor[MEM_SEARCH_MAX_PATTERNS][2];    /* Offsets of the two bytes that pick out candidates */
+    uint8_t anchor_byte[MEM_SEARCH_MAX_PATTERNS][2];
+    uint8_t anchor_mask[MEM_SEARCH_MAX_PATTERNS][2];
+    uint32_t anchor_end;                            /* Bytes past a candidate the anchors read */
+    bool horspool;
+    uint16_t shift[256];
+    mem_search_hit_t *hits;
+    uint32_t max_hits;
+    uint32_t found;
+} mem_search_t;
+
+static int mem_pattern_nibble(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return c == '?' ? 16 : -1;
+}
+
+bool mem_pattern_parse(mem_pattern_t *pattern, const char *text) {
+    uint32_t length = 0;
+
+    while (*text) {
+        int hi, lo;
+        if (*text == ' ' || *text == '\t') {
+            text++;
+            continue;
+        }
+        if (length == MEM_SEARCH_MAX_LENGTH) {
+            return false;
+        }
+        hi = mem_pattern_nibble(text[0]);
+        lo = hi < 0 ? -1 : mem_pattern_nibble(text[1]);
+        if (lo < 0) {
+            return false;
+        }
+        pattern->bytes[length] = (hi & 15) << 4 | (lo & 15);
+        pattern->mask[length] = (hi < 16 ? 0xF0 : 0) | (lo < 16 ? 0x0F : 0);
+        pattern->bytes[length] &= pattern->mask[length];
+        length++;
+        text += 2;
+    }
+
+    pattern->length = length;
+    return length != 0;
+}
+
+bool mem_pattern_bytes(mem_pattern_t *pattern, const uint8_t *bytes, uint32_t length) {
+    if (!length || length > MEM_SEARCH_MAX_LENGTH) {
+        return false;
+    }
+    memcpy(pattern->bytes, bytes, length);
+    memset(pattern->mask, 0xFF, length);
+    pattern->length = length;
+    return true;
+}
+
+static inline uint32_t mem_search_ctz(uint32_t x) {
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return i;
+#else
+    return __builtin_ctz(x);
+#endif
+}
+
+static uint32_t mem_search_bits(uint8_t x) {
+    uint32_t n = 0;
+    for (; x; x &= x - 1) {
+        n++;
+    }
+    return n;
+}
+
+static inline bool mem_search_match(const mem_pattern_t *pattern, const uint8_t *data) {
+    uint32_t i;
+    for (i = 0; i < pattern->length; i++) {
+        if ((data[i] & pattern->mask[i]) != pattern->bytes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Check a pattern at a candidate offset and record it if it matches */
+static inline void mem_search_check(mem_search_t *s, const uint8_t *data, uint32_t size, uint32_t i, uint32_t p, uint32_t base) {
+    const mem_pattern_t *pattern = &s->patterns[p];
+    if (i + pattern->length <= size && mem_search_match(pattern, data + i)) {
+        if (s->found < s->max_hits) {
+            s->hits[s->found].address = base + i;
+            s->hits[s->found].pattern = p;
+        }
+        s->found++;
+    }
+}
+
+static uint32_t mem_search_rank(const mem_pattern_t *pattern, uint32_t i, int avoid) {
+    uint8_t byte = pattern->bytes[i];
+    return mem_search_bits(pattern->mask[i]) * 4 + (byte != 0x00 && byte != 0xFF) * 2 + (byte != avoid);
+}
+
+/*
+ * Pick the two bytes of each pattern that candidates are found by: the ones with the most bits that have to
+ * match, preferring values other than 0x00 and 0xFF, which fill most of flash and RAM, and for the second one
+ * a value other than the first. A one byte pattern uses the same byte twice.
+ */
+static void mem_search_anchors(mem_search_t *s) {
+    uint32_t p, i, k;
+
+    s->anchor_end = 0;
+    for (p = 0; p < s->count; p++) {
+        const mem_pattern_t *pattern = &s->patterns[p];
+        uint32_t best[2] = { 0, 0 };
+        for (k = 0; k < 2; k++) {
+            int avoid = k ? pattern->bytes[best[0]] : -1;
+            uint32_t score = 0;
+            for (i = 0; i < pattern->length; i++) {
+                uint32_t rank = mem_search_rank(pattern, i, avoid);
+                if ((!k || i != best[0]) && rank > score) {
+                    score = rank;
+                    best[k] = i;
+                }
+            }
+            if (!score) {
+                best[k] = best[0];
+            }
+            s->anchor[p][k] = best[k];
+            s->anchor_byte[p][k] = pattern->bytes[best[k]];
+            s->anchor_mask[p][k] = pattern->mask[best[k]];
+            if (best[k] + 1 > s->anchor_end) {
+                s->anchor_end = best[k] + 1;
+            }
+        }
+    }
+}
+
+/*
+ * Horspool skip table for a single pattern. Any byte can sit under a wildcard or masked position, so the shift
+ * can never take the last of those past the end of the window.
+ */
+static void mem_search_shifts(mem_search_t *s) {
+    const mem_pattern_t *pattern = &s->patterns[0];
+    uint32_t m = pattern->length, i, c, limit = m;
+
+    for (i = 0; i + 1 < m; i++) {
+        if (pattern->mask[i] != 0xFF) {
+            limit = m - 1 - i;
+        }
+    }
+    for (c = 0; c < 256; c++) {
+        s->shift[c] = limit;
+    }
+    for (i = 0; i + 1 < m; i++) {
+        if (pattern->mask[i] == 0xFF && m - 1 - i < s->shift[pattern->bytes[i]]) {
+            s->shift[pattern->bytes[i]] = m - 1 - i;
+        }
+    }
+
+    /* Below a block's worth of skip, comparing 16 anchors at once wins; 0x00 and 0xFF decide the usual skip */
+    s->horspool = s->count == 1 && s->shift[0x00] >= 16 && s->shift[0xFF] >= 16;
+}
+
+static void mem_search_horspool(mem_search_t *s, const uint8_t *data, uint32_t size, uint32_t starts, uint32_t base) {
+    uint32_t m = s->patterns[0].length, i;
+
+    for (i = 0; i < starts && i + m <= size; i += s->shift[data[i + m - 1]]) {
+        mem_search_check(s, data, size, i, 0, base);
+    }
+}
+
+static uint32_t mem_search_scalar(mem_search_t *s, const uint8_t *data, uint32_t size, uint32_t starts, uint32_t i, uint32_t base) {
+    uint32_t p;
+
+    for (; i < starts; i++) {
+        for (p = 0; p < s->count; p++) {
+            uint32_t a = i + s->anchor[p][0], b = i + s->anchor[p][1];
+            if (a < size && b < size && (data[a] & s->anchor_mask[p][0]) == s->anchor_byte[p][0] &&
+                (data[b] & s->anchor_mask[p][1]) == s->anchor_byte[p][1]) {
+                mem_search_check(s, data, size, i, p, base);
+            }
+        }
+    }
+    return i;
+}
+
+#if defined(MEM_SEARCH_SIMD_X86) || defined(MEM_SEARCH_SIMD_SSE2_ONLY)
+/* Compare the anchors of all patterns against 16 offsets at a time and only look closer where both matched */
+MEM_SEARCH_TARGET_SSE2 static uint32_t mem_search_sse2(mem_search_t *s, const uint8_t *data, uint32_t size, uint32_t starts, uint32_t base) {
+    __m128i want[MEM_SEARCH_MAX_PATTERNS][2], mask[MEM_SEARCH_MAX_PATTERNS][2];
+    uint32_t bits[MEM_SEARCH_MAX_PATTERNS];
+    uint32_t i, p, k;
+
+    for (p = 0; p < s->count; p++) {
+        for (k = 0; k < 2; k++) {
+            want[p][k] = _mm_set1_epi8((char)s->anchor_byte[p][k]);
+            mask[p][k] = _mm_set1_epi8((char)s->anchor_mask[p][k]);
+        }
+    }
+    for (i = 0; i + 16 <= starts && i + 16 + s->anchor_end <= size; i += 16) {
+        uint32_t any = 0;
+        for (p = 0; p < s->count; p++) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(data + i + s->anchor[p][0]));
+            __m128i b = _mm_loadu_si128((const __m128i *)(data + i + s->anchor[p][1]));
+            a = _mm_cmpeq_epi8(_mm_and_si128(a, mask[p][0]), want[p][0]);
+            b = _mm_cmpeq_epi8(_mm_and_si128(b, mask[p][1]), want[p][1]);
+            bits[p] = (uint32_t)_mm_movemask_epi8(_mm_and_si128(a, b));
+            any |= bits[p];
+        }
+        while (any) {
+            uint32_t j = mem_search_ctz(any);
+            any &= any - 1;
+            for (p = 0; p < s->count; p++) {
+                if (bits[p] >> j & 1) {
+                    mem_search_check(s, data, size, i + j, p, base);
+                }
+            }
+        }
+    }
+    return i;
+}
+#endif
+
+#ifdef MEM_SEARCH_SIMD_NEON
+/* Same as the SSE2 version, with the compare narrowed to four bits per offset in place of a movemask */
+static uint32_t mem_search_neon(mem_search_t *s, const uint8_t *data, uint32_t size, uint32_t starts, uint32_t base) {
+    uint64_t bits[MEM_SEARCH_MAX_PATTERNS];
+    uint32_t i, p;
+
+    for (i = 0; i + 16 <= starts && i + 16 + s->anchor_end <= size; i += 16) {
+        uint64_t any = 0;
+        for (p = 0; p < s->count; p++) {
+            uint8x16_t a = vandq_u8(vld1q_u8(data + i + s->anchor[p][0]), vdupq_n_u8(s->anchor_mask[p][0]));
+            uint8x16_t b = vandq_u8(vld1q_u8(data + i + s->anchor[p][1]), vdupq_n_u8(s->anchor_mask[p][1]));
+            uint8x16_t eq = vandq_u8(vceqq_u8(a, vdupq_n_u8(s->anchor_byte[p][0])), vceqq_u8(b, vdupq_n_u8(s->anchor_byte[p][1])));
+            uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+            bits[p] = vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+            any |= bits[p];
+        }
+        while (any) {
+            uint32_t j = __builtin_ctzll(any) >> 2;
+            any &= ~(UINT64_C(0xF) << (j * 4));
+            for (p = 0; p < s->count; p++) {
+                if (bits[p] >> (j * 4) & 1) {
+                    mem_search_check(s, data, size, i + j, p, base);
+                }
+            }
+        }
+    }
+    return i;
+}
+#endif
+
+static bool mem_search_has_sse2(void) {
+#if defined(MEM_SEARCH_SIMD_X86)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#else
+    return true;
+#endif
+}
+
+/* Report every match that starts in the first starts bytes; matches have to end within size */
+static void mem_search_block(mem_search_t *s, const uint8_t *data, uint32_t size, uint32_t starts, uint32_t base) {
+    uint32_t i = 0;
+
+    if (s->horspool) {
+        mem_search_horspool(s, data, size, starts, base);
+        return;
+    }
+#if defined(MEM_SEARCH_SIMD_X86) || defined(MEM_SEARCH_SIMD_SSE2_ONLY)
+    if (mem_search_has_sse2()) {
+        i = mem_search_sse2(s, data, size, starts, base);
+    }
+#elif defined(MEM_SEARCH_SIMD_NEON)
+    i = mem_search_neon(s, data, size, starts, base);
+#endif
+    mem_search_scalar(s, data, size, starts, i, base);
+}
+
+/* Copy up to size bytes starting at address, stopping where the mapped memory does */
+static uint32_t mem_search_peek(uint8_t *out, uint32_t address, uint32_t size) {
+    uint32_t done = 0;
+
+    while (done < size && address < MEM_SEARCH_MAPPED_END) {
+        uint32_t run = size - done;
+        const uint8_t *span = phys_mem_span(address, &run);
+        if (!span) {
+            break;
+        }
+        memcpy(out + done, span, run);
+        done += run;
+        address += run;
+    }
+    return done;
+}
+
+/*
+ * Search each contiguous span in place. Matches that start in the last few bytes of a span may run on into
+ * the next one, so those offsets are searched in a small copy of where the two meet.
+ */
+static void mem_search_mapped(mem_search_t *s) {
+    uint8_t stitch[2 * MEM_SEARCH_MAX_LENGTH];
+    uint32_t overlap = s->longest - 1;
+    uint32_t address = 0;
+
+    while (address < MEM_SEARCH_MAPPED_END) {
+        uint32_t size = MEM_SEARCH_MAPPED_END - address;
+        const uint8_t *span = phys_mem_span(address, &size);
+        if (span) {
+            uint32_t tail = size < overlap ? size : overlap;
+            if (size > tail) {
+                mem_search_block(s, span, size, size - tail, address);
+            }
+            if (tail) {
+                memcpy(stitch, span + size - tail, tail);
+                mem_search_block(s, stitch, tail + mem_search_peek(stitch + tail, address + size, overlap), tail, address + size - tail);
+            }
+        }
+        address += size;
+    }
+}
+
+uint32_t mem_search(const mem_pattern_t *patterns, uint32_t count, mem_search_area_t area, mem_search_hit_t *hits, uint32_t max_hits) {
+    mem_search_t s;
+    uint32_t p;
+
+    if (!count || count > MEM_SEARCH_MAX_PATTERNS) {
+        return 0;
+    }
+
+    s.patterns = patterns;
+    s.count = count;
+    s.longest = 0;
+    for (p = 0; p < count; p++) {
+        if (!patterns[p].length || patterns[p].length > MEM_SEARCH_MAX_LENGTH) {
+            return 0;
+        }
+        if (patterns[p].length > s.longest) {
+            s.longest = patterns[p].length;
+        }
+    }
+    s.hits = hits;
+    s.max_hits = hits ? max_hits : 0;
+    s.found = 0;
+    mem_search_anchors(&s);
+    mem_search_shifts(&s);
+
+    switch (area) {
+        case MEM_SEARCH_FLASH:
+            if (mem.flash.block) {
+                mem_search_block(&s, mem.flash.block, flash_size, flash_size, 0);
+            }
+            break;
+        case MEM_SEARCH_RAM:
+            if (mem.ram.block) {
+                mem_search_block(&s, mem.ram.block, ram_size, ram_size, 0xD00000);
+            }
+            break;
+        case MEM_SEARCH_MAPPED:
+            mem_search_mapped(&s);
+            break;
+    }
+
+    return s.found;
+}
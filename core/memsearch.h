@@ -0,0 +1,51 @@
+#ifndef MEMSEARCH_H
+#define MEMSEARCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MEM_SEARCH_MAX_LENGTH   256
+#define MEM_SEARCH_MAX_PATTERNS 16
+
+/* A byte only has to match in the bits set in its mask, so a mask of 0 is a wildcard */
+typedef struct mem_pattern {
+    uint8_t bytes[MEM_SEARCH_MAX_LENGTH];
+    uint8_t mask[MEM_SEARCH_MAX_LENGTH];
+    uint32_t length;
+} mem_pattern_t;
+
+typedef enum {
+    MEM_SEARCH_FLASH,       /* The flash chip, at the addresses it has when it is not mirrored */
+    MEM_SEARCH_RAM,         /* RAM at 0xD00000 */
+    MEM_SEARCH_MAPPED       /* Everything below the ports as the CPU sees it, flash mirrors included */
+} mem_search_area_t;
+
+typedef struct mem_search_hit {
+    uint32_t address;
+    uint32_t pattern;       /* Index of the pattern that matched */
+} mem_search_hit_t;
+
+/*
+ * Parse hex bytes like "CD ?? ?? 02" into a pattern. Spaces are optional, "??" matches any byte and a single
+ * "?" nibble matches any value in that nibble, as in "3?". Returns false if the text is not a valid pattern.
+ */
+bool mem_pattern_parse(mem_pattern_t *pattern, const char *text);
+/* A pattern that matches these exact bytes */
+bool mem_pattern_bytes(mem_pattern_t *pattern, const uint8_t *bytes, uint32_t length);
+
+/*
+ * Find every match of any of the patterns in one pass over the area. Hits come in address order, and in
+ * pattern order where several patterns match at the same address. Up to max_hits of them are stored in hits;
+ * the return value is the number found, which is more than max_hits if the list had to be cut short.
+ */
+uint32_t mem_search(const mem_pattern_t *patterns, uint32_t count, mem_search_area_t area, mem_search_hit_t *hits, uint32_t max_hits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
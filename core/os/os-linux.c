@@ -1,7 +1,194 @@
 #include "os.h"
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 FILE *fopen_utf8(const char *filename, const char *mode)
 {
     return fopen(filename, mode);
 }
+
+struct os_thread {
+    pthread_t handle;
+};
+
+struct os_thread_start {
+    void (*entry)(void *);
+    void *arg;
+};
+
+static void *os_thread_main(void *param)
+{
+    struct os_thread_start start = *(struct os_thread_start *)param;
+    free(param);
+    start.entry(start.arg);
+    return NULL;
+}
+
+os_thread_t *os_thread_start(void (*entry)(void *), void *arg)
+{
+    os_thread_t *thread = malloc(sizeof(os_thread_t));
+    struct os_thread_start *start = malloc(sizeof(struct os_thread_start));
+    if (!thread || !start) {
+        free(thread);
+        free(start);
+        return NULL;
+    }
+    start->entry = entry;
+    start->arg = arg;
+    if (pthread_create(&thread->handle, NULL, os_thread_main, start)) {
+        free(thread);
+        free(start);
+        return NULL;
+    }
+    return thread;
+}
+
+void os_thread_join(os_thread_t *thread)
+{
+    pthread_join(thread->handle, NULL);
+    free(thread);
+}
+
+void os_thread_detach(os_thread_t *thread)
+{
+    pthread_detach(thread->handle);
+    free(thread);
+}
+
+void os_sleep_ms(unsigned int ms)
+{
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000;
+    nanosleep(&ts, NULL);
+}
+
+uint64_t os_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+struct os_shm {
+    char *name;
+    void *addr;
+    size_t size;
+};
+
+os_shm_t *os_shm_create(const char *name, size_t size)
+{
+    os_shm_t *shm = calloc(1, sizeof(os_shm_t));
+    size_t length;
+    int fd;
+
+    if (!shm) {
+        return NULL;
+    }
+
+    /* POSIX names have exactly one leading slash */
+    name += name[0] == '/';
+    length = strlen(name);
+    shm->name = malloc(length + 2);
+    if (!shm->name) {
+        free(shm);
+        return NULL;
+    }
+    shm->name[0] = '/';
+    memcpy(shm->name + 1, name, length + 1);
+    shm->size = size;
+
+    /* Only ever a fresh segment, since some systems can only size one once; an existing one may be in use */
+    fd = shm_open(shm->name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+        free(shm->name);
+        free(shm);
+        return NULL;
+    }
+    if (ftruncate(fd, size) == 0) {
+        shm->addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+
+    if (!shm->addr || shm->addr == MAP_FAILED) {
+        shm_unlink(shm->name);
+        free(shm->name);
+        free(shm);
+        return NULL;
+    }
+    return shm;
+}
+
+void *os_shm_address(os_shm_t *shm)
+{
+    return shm->addr;
+}
+
+void os_shm_destroy(os_shm_t *shm)
+{
+    munmap(shm->addr, shm->size);
+    shm_unlink(shm->name);
+    free(shm->name);
+    free(shm);
+}
+
+struct os_file_map {
+    void *addr;
+    size_t size;
+};
+
+os_file_map_t *os_file_map(const char *filename)
+{
+    os_file_map_t *map = calloc(1, sizeof(os_file_map_t));
+    struct stat st;
+    int fd;
+
+    if (!map) {
+        return NULL;
+    }
+    fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        free(map);
+        return NULL;
+    }
+    if (fstat(fd, &st) || !S_ISREG(st.st_mode)) {
+        close(fd);
+        free(map);
+        return NULL;
+    }
+    map->size = (size_t)st.st_size;
+    if (map->size) {
+        map->addr = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map->addr == MAP_FAILED) {
+            close(fd);
+            free(map);
+            return NULL;
+        }
+    }
+    close(fd);
+    return map;
+}
+
+const void *os_file_map_data(os_file_map_t *map)
+{
+    return map->addr;
+}
+
+size_t os_file_map_size(os_file_map_t *map)
+{
+    return map->size;
+}
+
+void os_file_unmap(os_file_map_t *map)
+{
+    if (map->addr) {
+        munmap(map->addr, map->size);
+    }
+    free(map);
+}
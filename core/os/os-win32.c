@@ -13,4 +13,178 @@ FILE *fopen_utf8(const char *filename, const char *mode)
     return _wfopen(filename_w, mode_w);
 }
 
+struct os_thread {
+    HANDLE handle;
+};
+
+struct os_thread_start {
+    void (*entry)(void *);
+    void *arg;
+};
+
+static DWORD WINAPI os_thread_main(LPVOID param)
+{
+    struct os_thread_start start = *(struct os_thread_start *)param;
+    free(param);
+    start.entry(start.arg);
+    return 0;
+}
+
+os_thread_t *os_thread_start(void (*entry)(void *), void *arg)
+{
+    os_thread_t *thread = malloc(sizeof(os_thread_t));
+    struct os_thread_start *start = malloc(sizeof(struct os_thread_start));
+    if (!thread || !start) {
+        free(thread);
+        free(start);
+        return NULL;
+    }
+    start->entry = entry;
+    start->arg = arg;
+    thread->handle = CreateThread(NULL, 0, os_thread_main, start, 0, NULL);
+    if (!thread->handle) {
+        free(thread);
+        free(start);
+        return NULL;
+    }
+    return thread;
+}
+
+void os_thread_join(os_thread_t *thread)
+{
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    free(thread);
+}
+
+void os_thread_detach(os_thread_t *thread)
+{
+    CloseHandle(thread->handle);
+    free(thread);
+}
+
+void os_sleep_ms(unsigned int ms)
+{
+    Sleep(ms);
+}
+
+uint64_t os_time_ns(void)
+{
+    LARGE_INTEGER count, frequency;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)(count.QuadPart / frequency.QuadPart) * 1000000000 +
+           (uint64_t)(count.QuadPart % frequency.QuadPart) * 1000000000 / (uint64_t)frequency.QuadPart;
+}
+
+struct os_shm {
+    HANDLE handle;
+    void *addr;
+};
+
+os_shm_t *os_shm_create(const char *name, size_t size)
+{
+    wchar_t name_w[MAX_PATH];
+    os_shm_t *shm = malloc(sizeof(os_shm_t));
+    if (!shm) {
+        return NULL;
+    }
+    MultiByteToWideChar(CP_UTF8, 0, name, -1, name_w, MAX_PATH);
+    shm->handle = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                     (DWORD)((unsigned long long)size >> 32), (DWORD)size, name_w);
+    if (!shm->handle) {
+        free(shm);
+        return NULL;
+    }
+    /* Like on other systems, don't take over a mapping something else already made */
+    if (GetLastError() == ERROR_ALREADY_EXISTS) {
+        CloseHandle(shm->handle);
+        free(shm);
+        return NULL;
+    }
+    shm->addr = MapViewOfFile(shm->handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!shm->addr) {
+        CloseHandle(shm->handle);
+        free(shm);
+        return NULL;
+    }
+    return shm;
+}
+
+void *os_shm_address(os_shm_t *shm)
+{
+    return shm->addr;
+}
+
+void os_shm_destroy(os_shm_t *shm)
+{
+    UnmapViewOfFile(shm->addr);
+    CloseHandle(shm->handle);
+    free(shm);
+}
+
+struct os_file_map {
+    HANDLE handle;
+    void *addr;
+    size_t size;
+};
+
+os_file_map_t *os_file_map(const char *filename)
+{
+    wchar_t filename_w[MAX_PATH];
+    LARGE_INTEGER size;
+    HANDLE file;
+    os_file_map_t *map = calloc(1, sizeof(os_file_map_t));
+    if (!map) {
+        return NULL;
+    }
+    MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_w, MAX_PATH);
+    file = CreateFileW(filename_w, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        free(map);
+        return NULL;
+    }
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        free(map);
+        return NULL;
+    }
+    map->size = (size_t)size.QuadPart;
+    if (map->size) {
+        map->handle = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (map->handle) {
+            map->addr = MapViewOfFile(map->handle, FILE_MAP_READ, 0, 0, 0);
+        }
+        if (!map->addr) {
+            if (map->handle) {
+                CloseHandle(map->handle);
+            }
+            CloseHandle(file);
+            free(map);
+            return NULL;
+        }
+    }
+    CloseHandle(file);
+    return map;
+}
+
+const void *os_file_map_data(os_file_map_t *map)
+{
+    return map->addr;
+}
+
+size_t os_file_map_size(os_file_map_t *map)
+{
+    return map->size;
+}
+
+void os_file_unmap(os_file_map_t *map)
+{
+    if (map->addr) {
+        UnmapViewOfFile(map->addr);
+        CloseHandle(map->handle);
+    }
+    free(map);
+}
+
 #endif
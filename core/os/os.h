@@ -12,6 +12,29 @@ extern "C" {
 /* Some really crappy APIs don't use UTF-8 in fopen. */
 FILE *fopen_utf8(const char *filename, const char *mode);
 
+/* Just enough threading for work that has to stay off the emulation thread */
+typedef struct os_thread os_thread_t;
+os_thread_t *os_thread_start(void (*entry)(void *), void *arg);
+void os_thread_join(os_thread_t *thread);
+void os_thread_detach(os_thread_t *thread);
+void os_sleep_ms(unsigned int ms);
+
+/* Nanoseconds on a clock that only goes forward, from some arbitrary start */
+uint64_t os_time_ns(void);
+
+/* Named shared memory that other local processes can map; it goes away when destroyed */
+typedef struct os_shm os_shm_t;
+os_shm_t *os_shm_create(const char *name, size_t size);
+void *os_shm_address(os_shm_t *shm);
+void os_shm_destroy(os_shm_t *shm);
+
+/* A whole file mapped read only, so it can be parsed without copying it; empty files have no data */
+typedef struct os_file_map os_file_map_t;
+os_file_map_t *os_file_map(const char *filename);
+const void *os_file_map_data(os_file_map_t *map);
+size_t os_file_map_size(os_file_map_t *map);
+void os_file_unmap(os_file_map_t *map);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "perf.h"
+#include "os/os.h"
+
+perf_t perf;
+
+const char *const perf_event_names[SCHED_NUM_ITEMS] = {
+    "throttle", "keypad", "lcd", "rtc", "ostimer", "timer1", "timer2", "timer3", "watchdog"
+};
+
+const char *const perf_range_names[PERF_RANGES] = {
+    "control", "flash", "sha256", "usb", "lcd", "interrupt", "watchdog", "timers",
+    "rtc", "protected", "keypad", "backlight", "cxxx", "dxxx", "exxx", "fxxx"
+};
+
+const char *const perf_host_names[PERF_HOST_COUNT] = {
+    "cpu", "gui", "throttle", "debugger"
+};
+
+void perf_reset(void) {
+    memset(&perf, 0, sizeof(perf));
+    perf.host_since = os_time_ns();
+    perf.host = PERF_HOST_CPU;
+}
+
+uint32_t perf_host_switch(uint32_t host) {
+    uint64_t now = os_time_ns();
+    uint32_t previous = perf.host;
+    perf.host_ns[previous] += now - perf.host_since;
+    perf.host_since = now;
+    perf.host = host;
+    return previous;
+}
+
+void perf_frame(void) {
+    uint64_t now = os_time_ns();
+    if (perf.frames) {
+        uint64_t elapsed = now - perf.last_frame;
+        perf.frame_ns[perf.frames % PERF_FRAMES] = elapsed > UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed;
+    }
+    perf.last_frame = now;
+    perf.frames++;
+}
+
+static int perf_compare(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+void perf_snapshot(perf_snapshot_t *s) {
+    uint32_t frames[PERF_FRAMES];
+    uint32_t host = perf.host, count;
+    uint64_t since = perf.host_since;
+
+    s->time_ns = os_time_ns();
+    s->cycles = perf.cycles;
+    s->instructions = perf.instructions;
+    s->interrupts = perf.interrupts;
+    s->flash_accesses = perf.flash_accesses;
+    s->flash_cycles = perf.flash_cycles;
+    memcpy(s->events, perf.events, sizeof(s->events));
+    memcpy(s->mmio_reads, perf.mmio_reads, sizeof(s->mmio_reads));
+    memcpy(s->mmio_writes, perf.mmio_writes, sizeof(s->mmio_writes));
+    memcpy(s->host_ns, perf.host_ns, sizeof(s->host_ns));
+    if (host < PERF_HOST_COUNT && s->time_ns > since) {
+        s->host_ns[host] += s->time_ns - since;
+    }
+
+    /* The first frame only starts the clock */
+    s->frames = perf.frames;
+    count = s->frames > PERF_FRAMES ? PERF_FRAMES : s->frames ? (uint32_t)s->frames - 1 : 0;
+    memcpy(frames, s->frames > PERF_FRAMES ? perf.frame_ns : perf.frame_ns + 1, count * sizeof(uint32_t));
+    qsort(frames, count, sizeof(uint32_t), perf_compare);
+    s->frame_p50_ns = count ? frames[(count - 1) * 50 / 100] : 0;
+    s->frame_p90_ns = count ? frames[(count - 1) * 90 / 100] : 0;
+    s->frame_p99_ns = count ? frames[(count - 1) * 99 / 100] : 0;
+    s->frame_max_ns = count ? frames[count - 1] : 0;
+}
+
+bool perf_dump_json(const char *path) {
+    perf_snapshot_t s;
+    FILE *file;
+    unsigned int i;
+    bool ok;
+
+    perf_snapshot(&s);
+    if (!(file = fopen_utf8(path, "a"))) {
+        return false;
+    }
+    fprintf(file, "{\"time_ns\":%llu,\"cycles\":%llu,\"instructions\":%llu,\"interrupts\":%llu,",
+            (unsigned long long)s.time_ns, (unsigned long long)s.cycles,
+            (unsigned long long)s.instructions, (unsigned long long)s.interrupts);
+    fprintf(file, "\"flash\":{\"accesses\":%llu,\"cycles\":%llu},\"events\":{",
+            (unsigned long long)s.flash_accesses, (unsigned long long)s.flash_cycles);
+    for (i = 0; i < SCHED_NUM_ITEMS; i++) {
+        fprintf(file, "%s\"%s\":%llu", i ? "," : "", perf_event_names[i], (unsigned long long)s.events[i]);
+    }
+    fputs("},\"mmio\":{", file);
+    for (i = 0; i < PERF_RANGES; i++) {
+        fprintf(file, "%s\"%s\":{\"reads\":%llu,\"writes\":%llu}", i ? "," : "", perf_range_names[i],
+                (unsigned long long)s.mmio_reads[i], (unsigned long long)s.mmio_writes[i]);
+    }
+    fputs("},\"host_ns\":{", file);
+    for (i = 0; i < PERF_HOST_COUNT; i++) {
+        fprintf(file, "%s\"%s\":%llu", i ? "," : "", perf_host_names[i], (unsigned long long)s.host_ns[i]);
+    }
+    fprintf(file, "},\"frames\":{\"count\":%llu,\"p50_ns\":%u,\"p90_ns\":%u,\"p99_ns\":%u,\"max_ns\":%u}}\n",
+            (unsigned long long)s.frames, s.frame_p50_ns, s.frame_p90_ns, s.frame_p99_ns, s.frame_max_ns);
+    ok = !ferror(file);
+    ok = !fclose(file) && ok;
+    return ok;
+}
@@ -0,0 +1,84 @@
+#ifndef PERF_H
+#define PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "defines.h"
+#include "schedule.h"
+
+/*
+ * Counters of what the emulation spends its time on, cheap enough to always be on. Only the emulation thread
+ * writes them; other threads go through perf_snapshot(), where a count can lag behind by a few increments.
+ * Everything counts from when the emulation last started.
+ */
+
+#define PERF_RANGES 0x10    /* One for each apb_map entry */
+#define PERF_FRAMES 256     /* Frame times kept for the percentiles */
+
+/* What the emulation thread is doing with the host's time */
+typedef enum {
+    PERF_HOST_CPU,          /* Emulating, including the peripherals */
+    PERF_HOST_GUI,          /* In callbacks to the GUI */
+    PERF_HOST_THROTTLE,     /* Sleeping to keep to the emulated speed */
+    PERF_HOST_DEBUGGER,     /* Stopped in the debugger */
+    PERF_HOST_COUNT
+} perf_host_t;
+
+typedef struct {
+    uint64_t cycles;                        /* As of the last throttle event */
+    uint64_t instructions;
+    uint64_t interrupts;
+    uint64_t flash_accesses;
+    uint64_t flash_cycles;                  /* Including the wait states */
+    uint64_t events[SCHED_NUM_ITEMS];
+    uint64_t mmio_reads[PERF_RANGES];       /* Port and memory mapped accesses alike */
+    uint64_t mmio_writes[PERF_RANGES];
+    uint64_t host_ns[PERF_HOST_COUNT];
+    uint64_t host_since;                    /* When the current kind of host time started */
+    uint32_t host;                          /* perf_host_t */
+    uint64_t frames;
+    uint64_t last_frame;                    /* Host time the last frame ended */
+    uint32_t frame_ns[PERF_FRAMES];         /* Host time between the last frames, oldest overwritten first */
+} perf_t;
+
+extern perf_t perf;
+
+typedef struct {
+    uint64_t time_ns;                       /* Host time of the snapshot */
+    uint64_t cycles;
+    uint64_t instructions;
+    uint64_t interrupts;
+    uint64_t flash_accesses;
+    uint64_t flash_cycles;
+    uint64_t events[SCHED_NUM_ITEMS];
+    uint64_t mmio_reads[PERF_RANGES];
+    uint64_t mmio_writes[PERF_RANGES];
+    uint64_t host_ns[PERF_HOST_COUNT];      /* Up to the snapshot */
+    uint64_t frames;
+    uint32_t frame_p50_ns, frame_p90_ns, frame_p99_ns, frame_max_ns;  /* Over the last PERF_FRAMES frames */
+} perf_snapshot_t;
+
+extern const char *const perf_event_names[SCHED_NUM_ITEMS];
+extern const char *const perf_range_names[PERF_RANGES];
+extern const char *const perf_host_names[PERF_HOST_COUNT];
+
+void perf_reset(void);
+/* Charge the host time since the last switch to what was being done, then start timing host; returns what that was */
+uint32_t perf_host_switch(uint32_t host);
+/* At the end of each LCD frame */
+void perf_frame(void);
+
+void perf_snapshot(perf_snapshot_t *snapshot);
+/* Append a snapshot to path as one line of JSON; false if it couldn't be written */
+bool perf_dump_json(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
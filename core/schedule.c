@@ -17,9 +17,15 @@
 #include "cpu.h"
 #include "emu.h"
 #include "schedule.h"
+#include "perf.h"
+#include "debug/profiler.h"
+#include "debug/timeline.h"
 
 sched_state_t sched;
 
+/* CPU cycles of all the seconds that have passed; kept outside of sched so images stay compatible */
+static uint64_t sched_cycles_base;
+
 static uint32_t muldiv(uint32_t a, uint32_t b, uint32_t c) {
 #if defined(__i386__) || defined(__x86_64__)
     asm ("mull %k1\n\tdivl %k2" : "+a" (a) : "g" (b), "g" (c) : "cc", "edx");
@@ -65,6 +71,14 @@ void sched_update_next_event(void) {
     /* printf("Next event: (%8d,%d)\n", next_cputick, next_index); */
     cpu.next = sched.nextCPUtick;
 #ifdef DEBUG_SUPPORT
+    /* Samples aren't events, so they don't change what goes into images. sched_set_clocks() can take the base
+     * below zero when it scales cpu.cycles up, so the sample is only compared by its distance from the base. */
+    if (profiler.mode == PROFILER_SAMPLE) {
+        int64_t sample = (int64_t)(profiler.next_sample - sched_cycles_base);
+        if (sample < (int64_t)cpu.next) {
+            cpu.next = sample > 0 ? (uint32_t)sample : 0;
+        }
+    }
     if (!cpu.halted && cpuEvents & EVENT_DEBUG_STEP) {
         cpu.next = debugger.cpu_cycles + 1;
     }
@@ -72,6 +86,11 @@ void sched_update_next_event(void) {
 }
 
 void sched_process_pending_events(void) {
+#ifdef DEBUG_SUPPORT
+    if (profiler.mode == PROFILER_SAMPLE && sched_total_cycles() >= profiler.next_sample) {
+        profiler_sample();
+    }
+#endif
     sched_update_next_event();
     while (cpu.cycles >= sched.nextCPUtick) {
         if (sched.nextIndex < 0) {
@@ -82,11 +101,27 @@ void sched_process_pending_events(void) {
                     sched.items[i].second--;
                 }
             }
+            sched_cycles_base += sched.clockRates[CLOCK_CPU];
             cpu.cycles -= sched.clockRates[CLOCK_CPU];
         } else {
+#ifdef DEBUG_SUPPORT
+            timeline_handle_t handle = { 0, 0 };
+#endif
             /* printf("[%8d/%8d] Event %d\n", cputick, sched.next_cputick, sched.next_index); */
             sched.items[sched.nextIndex].second = -1;
+            perf.events[sched.nextIndex]++;
+#ifdef DEBUG_SUPPORT
+            /* The throttle records its own wait; the GUI work it also does can sit in the debugger for any time */
+            if (timeline.active && sched.nextIndex != SCHED_THROTTLE) {
+                handle = timeline_begin(TIMELINE_EVENT, (uint32_t)sched.nextIndex);
+            }
+#endif
             sched.items[sched.nextIndex].proc(sched.nextIndex);
+#ifdef DEBUG_SUPPORT
+            if (handle.generation) {
+                timeline_end(handle);
+            }
+#endif
         }
         sched_update_next_event();
     }
@@ -118,6 +153,10 @@ uint64_t event_ticks_remaining(int index) {
         + item->tick - muldiv(cpu.cycles, sched.clockRates[item->clock], sched.clockRates[CLOCK_CPU]);
 }
 
+uint64_t sched_total_cycles(void) {
+    return sched_cycles_base + cpu.cycles;
+}
+
 void sched_set_clocks(int count, uint32_t *new_rates) {
     int i;
     uint64_t remaining[SCHED_NUM_ITEMS];
@@ -130,7 +169,10 @@ void sched_set_clocks(int count, uint32_t *new_rates) {
         }
     }
 
+    /* The total stays where it was, so profiler.next_sample still holds; the base can wrap below zero here */
+    sched_cycles_base += cpu.cycles;
     cpu.cycles = muldiv(cpu.cycles, new_rates[CLOCK_CPU], sched.clockRates[CLOCK_CPU]);
+    sched_cycles_base -= cpu.cycles;
     memcpy(sched.clockRates, new_rates, sizeof(uint32_t) * count);
 
     for (i = 0; i < SCHED_NUM_ITEMS; i++) {
@@ -49,6 +49,8 @@ void event_clear(int index);
 void event_set(int index, uint64_t ticks);
 void sched_set_clocks(int count, uint32_t *new_rates);
 uint64_t event_ticks_remaining(int index);
+/* CPU cycles emulated so far; a reset or restored image can take it back by less than a second */
+uint64_t sched_total_cycles(void);
 
 /* Save/Restore */
 typedef struct emu_image emu_image;
@@ -0,0 +1,97 @@
+#include <string.h>
+
+#include "shmexport.h"
+#include "emu.h"
+#include "os/os.h"
+
+#define SHM_EXPORT_FRAME_SIZE (320 * 240 * 4)
+#define SHM_EXPORT_SIZE (sizeof(shm_export_header_t) + SHM_EXPORT_FRAME_SIZE + ram_size)
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define shm_export_begin(ptr, value) InterlockedExchange((volatile LONG *)(ptr), (LONG)(value))
+#define shm_export_end(ptr, value) InterlockedExchange((volatile LONG *)(ptr), (LONG)(value))
+#else
+/* The odd count has to be visible before any of the data changes, and the data before the even count */
+#define shm_export_begin(ptr, value) (__atomic_store_n((ptr), (value), __ATOMIC_RELAXED), __atomic_thread_fence(__ATOMIC_RELEASE))
+#define shm_export_end(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif
+
+static os_shm_t *shm_export = NULL;
+static shm_export_header_t *shm_export_header;
+
+bool shm_export_start(const char *name) {
+    shm_export_header_t *header;
+
+    shm_export_stop();
+
+    shm_export = os_shm_create(name, SHM_EXPORT_SIZE);
+    if (!shm_export) {
+        gui_console_err_printf("[CEmu] Could not create shared memory %s; is something else sharing under that name?\n",
+                               name);
+        return false;
+    }
+
+    header = os_shm_address(shm_export);
+    memset(header, 0, SHM_EXPORT_SIZE);
+    header->version = SHM_EXPORT_VERSION;
+    header->size = SHM_EXPORT_SIZE;
+    header->width = 320;
+    header->height = 240;
+    header->frameOffset = sizeof(shm_export_header_t);
+    header->ramOffset = sizeof(shm_export_header_t) + SHM_EXPORT_FRAME_SIZE;
+    header->ramSize = ram_size;
+    shm_export_end(&header->magic, SHM_EXPORT_MAGIC);
+    shm_export_header = header;
+
+    /* Readers get something to look at before the next vcomp */
+    if (lcd_frame_published()->seq) {
+        shm_export_frame(lcd_frame_published());
+    }
+
+    gui_console_printf("[CEmu] Sharing the screen and RAM as %s.\n", name);
+    return true;
+}
+
+void shm_export_stop(void) {
+    if (shm_export) {
+        os_shm_destroy(shm_export);
+        shm_export = NULL;
+        shm_export_header = NULL;
+    }
+}
+
+bool shm_export_active(void) {
+    return shm_export != NULL;
+}
+
+void shm_export_frame(const lcd_frame_t *frame) {
+    shm_export_header_t *header = shm_export_header;
+    uint8_t *base = (uint8_t *)header;
+    uint32_t seq, top = 0, height = 240;
+
+    if (!header || !mem.ram.block) {
+        return;
+    }
+
+    /* Following on from the frame already in there, only the rows that changed have to be copied */
+    if (header->frame && frame->seq == header->frame + 1) {
+        top = frame->dirty.y;
+        height = frame->dirty.height;
+    }
+
+    seq = header->seq;
+    shm_export_begin(&header->seq, seq + 1);
+
+    memcpy(base + header->frameOffset + top * 320 * 4, frame->pixels + top * 320, height * 320 * 4);
+    /* Copying all of RAM costs far more than the rows of a frame, so it isn't done every time */
+    if (!header->ramFrame || frame->seq - header->ramFrame >= SHM_EXPORT_RAM_FRAMES) {
+        memcpy(base + header->ramOffset, mem.ram.block, ram_size);
+        header->ramFrame = frame->seq;
+    }
+    header->frame = frame->seq;
+    header->brightness = frame->brightness;
+    header->cycles = sched_total_cycles();
+
+    shm_export_end(&header->seq, seq + 2);
+}
@@ -0,0 +1,52 @@
+#ifndef SHMEXPORT_H
+#define SHMEXPORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd.h"
+
+#define SHM_EXPORT_MAGIC   0x756D4543   /* "CEmu" */
+#define SHM_EXPORT_VERSION 2
+
+/* RAM is copied on every this many frames, which is plenty for anything watching it by eye */
+#define SHM_EXPORT_RAM_FRAMES 4
+
+/*
+ * Start of the shared segment; offsets are from here. Readers map it read-only and treat seq as a seqlock:
+ * read seq and retry while it is odd, copy what they need, then retry if seq is no longer the same. Both are
+ * written at vcomp, but RAM only every SHM_EXPORT_RAM_FRAMES frames; ramFrame says which frame it came from.
+ */
+typedef struct shm_export_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;          /* Size of the whole segment */
+    uint32_t width, height;
+    uint32_t frameOffset;   /* RGBA8888 pixels, not dimmed */
+    uint32_t ramOffset;     /* RAM as the CPU sees it at 0xD00000 */
+    uint32_t ramSize;
+    uint32_t seq;           /* Odd while an update is being written */
+    uint32_t frame;         /* Number of the emulated frame */
+    uint32_t brightness;    /* Backlight level at the time */
+    uint32_t ramFrame;      /* Number of the emulated frame the RAM was copied at */
+    uint64_t cycles;        /* Emulated CPU cycles at the time */
+    uint8_t padding[8];
+} shm_export_header_t;
+
+/* Create or remove the segment; call from the emulation thread or while it is not running */
+bool shm_export_start(const char *name);
+void shm_export_stop(void);
+bool shm_export_active(void);
+
+/* Publish a frame and the RAM behind it; called from lcd_event() */
+void shm_export_frame(const lcd_frame_t *frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
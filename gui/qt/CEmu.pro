@@ -51,6 +51,7 @@ if (macx|linux) {
 }
 
 macx:  QMAKE_LFLAGS += -Wl,-dead_strip
+linux: LIBS += -lrt
 linux: QMAKE_LFLAGS += -Wl,-z,relro -Wl,-z,now -Wl,-z,noexecstack -Wl,--gc-sections -pie
 
 QMAKE_CFLAGS    += $$GLOBAL_FLAGS
@@ -70,6 +71,8 @@ SOURCES +=  utils.cpp \
     romselection.cpp \
     qtframebuffer.cpp \
     lcdwidget.cpp \
+    lcdscaler.cpp \
+    memorydevice.cpp \
     emuthread.cpp \
     qtkeypadbridge.cpp \
     qmlbridge.cpp \
@@ -84,6 +87,12 @@ SOURCES +=  utils.cpp \
     ../../core/cpu.c \
     ../../core/keypad.c \
     ../../core/lcd.c \
+    ../../core/lcdstream.c \
+    ../../core/lcdhash.c \
+    ../../core/shmexport.c \
+    ../../core/memsearch.c \
+    ../../core/memscan.c \
+    ../../core/perf.c \
     ../../core/registers.c \
     ../../core/apb.c \
     ../../core/interrupt.c \
@@ -100,13 +109,25 @@ SOURCES +=  utils.cpp \
     ../../core/mem.c \
     ../../core/link.c \
     ../../core/vat.c \
+    ../../core/debug/opcodes.c \
     ../../core/debug/disasm.cpp \
+    ../../core/debug/symbols.cpp \
+    ../../core/debug/analysis.c \
+    ../../core/debug/profiler.c \
+    ../../core/debug/trace.c \
+    ../../core/debug/coverage.c \
+    ../../core/debug/iotrace.c \
+    ../../core/debug/timeline.c \
     ../../core/debug/debug.c \
     ../../core/emu.c \
     capture/gif.cpp \
+    capture/lcdgif.cpp \
     datawidget.cpp \
+    disasmwidget.cpp \
     lcdpopout.cpp \
     searchwidget.cpp \
+    memscanwidget.cpp \
+    perfwidget.cpp \
     basiccodeviewerwindow.cpp \
     ../../core/debug/stepping.cpp
 
@@ -118,6 +139,8 @@ HEADERS  +=  utils.h \
     romselection.h \
     qtframebuffer.h \
     lcdwidget.h \
+    lcdscaler.h \
+    memorydevice.h \
     emuthread.h \
     qtkeypadbridge.h \
     qmlbridge.h \
@@ -139,6 +162,12 @@ HEADERS  +=  utils.h \
     ../../core/defines.h \
     ../../core/keypad.h \
     ../../core/lcd.h \
+    ../../core/lcdstream.h \
+    ../../core/lcdhash.h \
+    ../../core/shmexport.h \
+    ../../core/memsearch.h \
+    ../../core/memscan.h \
+    ../../core/perf.h \
     ../../core/registers.h \
     ../../core/tidevices.h \
     ../../core/apb.h \
@@ -158,13 +187,24 @@ HEADERS  +=  utils.h \
     ../../core/link.h \
     ../../core/vat.h \
     ../../core/debug/debug.h \
+    ../../core/debug/opcodes.h \
     ../../core/debug/disasm.h \
+    ../../core/debug/symbols.h \
+    ../../core/debug/analysis.h \
+    ../../core/debug/profiler.h \
+    ../../core/debug/trace.h \
+    ../../core/debug/coverage.h \
+    ../../core/debug/iotrace.h \
+    ../../core/debug/timeline.h \
     ../../core/os/os.h \
     capture/gif.h \
-    capture/giflib.h \
+    capture/lcdgif.h \
     datawidget.h \
+    disasmwidget.h \
     lcdpopout.h \
     searchwidget.h \
+    memscanwidget.h \
+    perfwidget.h \
     basiccodeviewerwindow.h \
     ../../core/debug/stepping.h
 
@@ -172,6 +212,7 @@ FORMS    += mainwindow.ui \
     romselection.ui \
     lcdpopout.ui \
     searchwidget.ui \
+    memscanwidget.ui \
     basiccodeviewerwindow.ui
 
 RESOURCES += \
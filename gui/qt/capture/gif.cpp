@@ -1,58 +1,171 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <mutex>
+#include <thread>
+#include <vector>
 #include <QtGui/QImage>
 
 #include "gif.h"
-#include "giflib.h"
+#include "lcdgif.h"
 #include "qtframebuffer.h"
+#include "../../core/emu.h"
 
+// Frames copied out of lcd_event() and waiting for the encoder thread
+struct gif_slot {
+    unsigned int frame;
+    uint32_t pixels[320 * 240];
+};
+
+static const unsigned int gif_queue_size = 16;
+
+// Only start and stop take this; the emulator thread goes by recording and gif_in_frame instead
 static std::mutex gif_mutex;
-static bool recording = false;
-static GifWriter writer;
-static unsigned int frame, frameskip, gifTime;
+static std::atomic<bool> recording(false), gif_in_frame(false);
+static lcd_gif_writer writer;
+static unsigned int frame, frameskip, dropped;
+static gif_queue_policy policy;
 
-static bool gif_write_frame(GifWriter *frameWriter, unsigned int delay) {
-    return GifWriteFrame(frameWriter, renderFramebuffer(&lcd).convertToFormat(QImage::Format_RGBA8888).bits(), 320, 240, delay);
-}
+// Single producer (emulator thread), single consumer (encoder thread); indices only ever increase
+static std::vector<gif_slot> gif_queue;
+static std::atomic<unsigned int> gif_head(0), gif_tail(0);
+static std::atomic<bool> gif_stopping(false), gif_failed(false);
+static std::mutex gif_wake_mutex;
+static std::condition_variable gif_wake;
+static std::mutex gif_space_mutex;
+static std::condition_variable gif_space;
+static std::thread gif_encoder;
 
 bool gif_single_frame(const char *filename) {
-    GifWriter frameWriter;
+    lcd_gif_writer frameWriter;
+    QImage image = renderFramebuffer(&lcd);
 
-    return GifBegin(&frameWriter, filename, 320, 240, 0) && gif_write_frame(&frameWriter, 0) && GifEnd(&frameWriter);
+    return lcd_gif_begin(&frameWriter, filename, false)
+           && lcd_gif_write_frame(&frameWriter, reinterpret_cast<const uint32_t*>(image.constBits()), 0)
+           && lcd_gif_end(&frameWriter);
 }
 
-bool gif_start_recording(const char *filename, unsigned int frameskip_) {
+static void gif_encode() {
+    unsigned int gifTime = 0;
+
+    for (;;) {
+        unsigned int tail = gif_tail.load(std::memory_order_relaxed);
+
+        if (tail == gif_head.load(std::memory_order_acquire)) {
+            if (gif_stopping.load()) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(gif_wake_mutex);
+            gif_wake.wait_for(lock, std::chrono::milliseconds(10));
+            continue;
+        }
+
+        // Dropped frames just lengthen the delay of the one before them
+        const gif_slot &slot = gif_queue[tail % gif_queue_size];
+        unsigned int time = (slot.frame * 100 + 15) / 30;
+        if (!gif_failed.load() && !lcd_gif_write_frame(&writer, slot.pixels, time - gifTime)) {
+            gif_failed.store(true);
+        }
+        gifTime = time;
+
+        gif_tail.store(tail + 1, std::memory_order_release);
+        {
+            // Taken so the emulator thread can't miss this between checking the queue and waiting
+            std::lock_guard<std::mutex> lock(gif_space_mutex);
+        }
+        gif_space.notify_one();
+    }
+}
+
+bool gif_start_recording(const char *filename, unsigned int frameskip_, gif_queue_policy policy_) {
     std::lock_guard<std::mutex> lock(gif_mutex);
 
-    if (GifBegin(&writer, filename, 320, 240, 1)) {
-        recording = true;
+    if (!recording.load() && lcd_gif_begin(&writer, filename, true)) {
         frame = 0;
         frameskip = frameskip_;
-        gifTime = 0;
+        dropped = 0;
+        policy = policy_;
+        gif_queue.resize(gif_queue_size);
+        gif_head.store(0);
+        gif_tail.store(0);
+        gif_stopping.store(false);
+        gif_failed.store(false);
+        gif_encoder = std::thread(gif_encode);
+        recording.store(true);
     }
 
     return recording;
 }
 
-void gif_new_frame() {
-    std::lock_guard<std::mutex> lock(gif_mutex);
-
-    if (!recording || (++frame % (frameskip + 1))) {
+static void gif_queue_frame() {
+    if (gif_failed.load() || (++frame % (frameskip + 1))) {
         return;
     }
 
-    int lastGifTime = gifTime;
-    gifTime = (frame * 100 + 15) / 30;
+    unsigned int head = gif_head.load(std::memory_order_relaxed);
+    if (head - gif_tail.load(std::memory_order_acquire) == gif_queue_size) {
+        if (policy == GIF_DROP_FRAMES) {
+            dropped++;
+            return;
+        }
 
-    if (!gif_write_frame(&writer, gifTime - lastGifTime)) {
-        recording = false;
-        GifEnd(&writer);
+        // Sleep until the encoder frees a slot, or gif_stop_recording() gives up on this frame
+        std::unique_lock<std::mutex> spaceLock(gif_space_mutex);
+        gif_space.wait(spaceLock, [head] {
+            return head - gif_tail.load(std::memory_order_acquire) != gif_queue_size || !recording.load();
+        });
+        if (!recording.load()) {
+            return;
+        }
     }
+
+    gif_slot &slot = gif_queue[head % gif_queue_size];
+    slot.frame = frame;
+    memcpy(slot.pixels, lcd_frame_published()->pixels, sizeof(slot.pixels));
+    gif_head.store(head + 1, std::memory_order_release);
+    gif_wake.notify_one();
+}
+
+// Runs from lcd_event(), right after the core converted this frame; only copies it out, and never
+// waits on the GUI thread, only on the encoder when asked to keep every frame
+void gif_new_frame() {
+    // Paired with gif_stop_recording(): either it sees this frame in progress, or this sees it stopped
+    gif_in_frame.store(true);
+    if (recording.load()) {
+        gif_queue_frame();
+    }
+    gif_in_frame.store(false);
 }
 
 bool gif_stop_recording() {
-    std::lock_guard<std::mutex> lock(gif_mutex);
+    {
+        std::lock_guard<std::mutex> lock(gif_mutex);
+        if (!recording.load()) {
+            return false;
+        }
+        recording.store(false);
+    }
+
+    // Wake a frame waiting for space, then let it leave the queue alone before tearing it down
+    {
+        std::lock_guard<std::mutex> lock(gif_space_mutex);
+    }
+    gif_space.notify_one();
+    while (gif_in_frame.load()) {
+        std::this_thread::yield();
+    }
+
+    // Let the encoder finish whatever is still queued
+    gif_stopping.store(true);
+    gif_wake.notify_one();
+    gif_encoder.join();
+    gif_queue.clear();
+    gif_queue.shrink_to_fit();
+
+    if (dropped) {
+        gui_console_printf("[CEmu] GIF encoder fell behind, %u frames were dropped.\n", dropped);
+    }
 
-    bool wasRecording = recording;
-    recording = false;
-    return wasRecording && GifEnd(&writer);
+    return lcd_gif_end(&writer) && !gif_failed.load();
 }
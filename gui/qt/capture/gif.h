@@ -1,8 +1,14 @@
 #ifndef GIF_H
 #define GIF_H
 
+// What the emulator thread does when the encoder thread has fallen behind
+enum gif_queue_policy {
+    GIF_DROP_FRAMES,
+    GIF_WAIT_FOR_ENCODER
+};
+
 bool gif_single_frame(const char *filename);
-bool gif_start_recording(const char *filename, unsigned int frameskip);
+bool gif_start_recording(const char *filename, unsigned int frameskip, gif_queue_policy policy = GIF_DROP_FRAMES);
 void gif_new_frame();
 bool gif_stop_recording();
 
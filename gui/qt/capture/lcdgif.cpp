@@ -0,0 +1,402 @@
+#include "lcdgif.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "../../core/os/os.h"
+
+static const unsigned int gif_width = 320;
+static const unsigned int gif_height = 240;
+static const unsigned int gif_lzw_table = 8192;
+
+static inline uint16_t gif_key(uint32_t pixel) {
+    return (pixel >> 3 & 0x1F) << 11 | (pixel >> 10 & 0x3F) << 5 | (pixel >> 19 & 0x1F);
+}
+
+static void gif_put16(std::vector<uint8_t> &out, unsigned int value) {
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8 & 0xFF);
+}
+
+bool lcd_gif_begin(lcd_gif_writer *writer, const char *filename, bool animated) {
+    static const uint8_t header[] = {
+        'G', 'I', 'F', '8', '9', 'a',
+        gif_width & 0xFF, gif_width >> 8, gif_height & 0xFF, gif_height >> 8,
+        0xF0, 0, 0,               // dummy global table of 2 entries, every frame brings its own
+        0, 0, 0, 0, 0, 0
+    };
+    static const uint8_t loop[] = {
+        0x21, 0xFF, 11, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 3, 1, 0, 0, 0
+    };
+
+    writer->file = fopen_utf8(filename, "wb");
+    if (!writer->file) {
+        return false;
+    }
+
+    writer->first = true;
+    writer->last.assign(gif_width * gif_height, 0);
+    writer->indices.resize(gif_width * gif_height);
+    writer->out.clear();
+    writer->count = 0;
+    writer->depth = 1;
+    writer->exact = true;
+    writer->rgb[0] = 0;
+    writer->map.assign(0x10000, 0);
+    writer->stamp.assign(0x10000, 0);
+    writer->generation = 0;
+    writer->counts.assign(0x10000, 0);
+    writer->samples.assign(0x10000, 0);
+    writer->distinct.clear();
+    writer->lzwKeys.resize(gif_lzw_table);
+    writer->lzwCodes.resize(gif_lzw_table);
+
+    fwrite(header, 1, sizeof(header), writer->file);
+    if (animated) {
+        fwrite(loop, 1, sizeof(loop), writer->file);
+    }
+    return !ferror(writer->file);
+}
+
+/* Median cut over the histogram, for the rare frame with more than 255 colors */
+static void gif_split_palette(lcd_gif_writer *writer) {
+    struct box { size_t begin, end; };
+    std::vector<uint16_t> &keys = writer->distinct;
+    const std::vector<uint32_t> &counts = writer->counts;
+    std::vector<box> boxes(1, box{ 0, keys.size() });
+
+    static const unsigned int shifts[3] = { 11, 5, 0 };
+    static const unsigned int masks[3] = { 0x1F, 0x3F, 0x1F };
+    static const unsigned int scales[3] = { 2, 1, 2 };
+
+    while (boxes.size() < 255) {
+        size_t best = boxes.size();
+        unsigned int bestSpan = 0, bestChannel = 0;
+
+        for (size_t i = 0; i < boxes.size(); i++) {
+            for (unsigned int c = 0; c < 3; c++) {
+                unsigned int lo = ~0u, hi = 0;
+                for (size_t k = boxes[i].begin; k < boxes[i].end; k++) {
+                    unsigned int v = (keys[k] >> shifts[c] & masks[c]) * scales[c];
+                    lo = std::min(lo, v);
+                    hi = std::max(hi, v);
+                }
+                if (hi > lo && hi - lo > bestSpan) {
+                    bestSpan = hi - lo;
+                    best = i;
+                    bestChannel = c;
+                }
+            }
+        }
+        if (best == boxes.size()) {
+            break;
+        }
+
+        box &b = boxes[best];
+        unsigned int shift = shifts[bestChannel], mask = masks[bestChannel];
+        std::sort(keys.begin() + b.begin, keys.begin() + b.end, [=](uint16_t x, uint16_t y) {
+            return (x >> shift & mask) < (y >> shift & mask);
+        });
+
+        uint64_t total = 0, running = 0;
+        for (size_t k = b.begin; k < b.end; k++) {
+            total += counts[keys[k]];
+        }
+        size_t split = b.begin + 1;
+        for (size_t k = b.begin; k < b.end - 1; k++) {
+            running += counts[keys[k]];
+            split = k + 1;
+            if (running * 2 >= total) {
+                break;
+            }
+        }
+
+        box upper = { split, b.end };
+        b.end = split;
+        boxes.push_back(upper);
+    }
+
+    writer->generation++;
+    writer->count = boxes.size();
+    for (size_t i = 0; i < boxes.size(); i++) {
+        uint64_t r = 0, g = 0, b = 0, n = 0;
+        for (size_t k = boxes[i].begin; k < boxes[i].end; k++) {
+            uint16_t key = keys[k];
+            uint32_t sample = writer->samples[key];
+            uint32_t weight = counts[key];
+            r += (sample & 0xFF) * weight;
+            g += (sample >> 8 & 0xFF) * weight;
+            b += (sample >> 16 & 0xFF) * weight;
+            n += weight;
+            writer->map[key] = i + 1;
+            writer->stamp[key] = writer->generation;
+        }
+        writer->rgb[i + 1] = (r / n) | (g / n) << 8 | (b / n) << 16;
+        writer->keys[i + 1] = keys[boxes[i].begin];
+    }
+    writer->exact = false;
+}
+
+/* Palette holding exactly the colors that changed, topped up with the previous palette while it costs no extra bits */
+static void gif_build_palette(lcd_gif_writer *writer, const uint32_t *pixels, unsigned int x0, unsigned int y0,
+                              unsigned int width, unsigned int height) {
+    std::vector<uint16_t> &keys = writer->distinct;
+
+    keys.clear();
+    for (unsigned int y = y0; y < y0 + height; y++) {
+        const uint32_t *row = pixels + y * gif_width;
+        const uint32_t *last = writer->last.data() + y * gif_width;
+        for (unsigned int x = x0; x < x0 + width; x++) {
+            if (writer->first || row[x] != last[x]) {
+                uint16_t key = gif_key(row[x]);
+                if (!writer->counts[key]++) {
+                    writer->samples[key] = row[x];
+                    keys.push_back(key);
+                }
+            }
+        }
+    }
+
+    if (keys.size() > 255) {
+        gif_split_palette(writer);
+    } else {
+        uint32_t generation = ++writer->generation;
+        unsigned int count = 0;
+        unsigned int depth = 1;
+        unsigned int oldCount = writer->exact ? writer->count : 0;
+        uint16_t oldKeys[256];
+        uint32_t oldRgb[256];
+
+        memcpy(oldKeys, writer->keys, sizeof(oldKeys));
+        memcpy(oldRgb, writer->rgb, sizeof(oldRgb));
+
+        for (uint16_t key : keys) {
+            count++;
+            writer->map[key] = count;
+            writer->stamp[key] = generation;
+            writer->keys[count] = key;
+            writer->rgb[count] = writer->samples[key] & 0xFFFFFF;
+        }
+        while ((1u << depth) < count + 1) {
+            depth++;
+        }
+
+        for (unsigned int i = 1; i <= oldCount && count + 1 < (1u << depth); i++) {
+            uint16_t key = oldKeys[i];
+            if (writer->stamp[key] != generation) {
+                count++;
+                writer->map[key] = count;
+                writer->stamp[key] = generation;
+                writer->keys[count] = key;
+                writer->rgb[count] = oldRgb[i];
+            }
+        }
+
+        writer->count = count;
+        writer->exact = true;
+    }
+
+    for (uint16_t key : keys) {
+        writer->counts[key] = 0;
+    }
+}
+
+/* LZW-compress the indices into 255-byte sub-blocks; the dictionary is an open-addressed hash table */
+static void gif_compress(lcd_gif_writer *writer, size_t size, unsigned int minCodeSize) {
+    std::vector<uint8_t> &out = writer->out;
+    int32_t *keys = writer->lzwKeys.data();
+    uint16_t *codes = writer->lzwCodes.data();
+    const uint8_t *indices = writer->indices.data();
+    const uint32_t clearCode = 1u << minCodeSize;
+
+    uint32_t codeSize = minCodeSize + 1;
+    uint32_t maxCode = clearCode + 1;
+    uint32_t bits = 0, bitCount = 0;
+    size_t block = out.size();
+
+    out.push_back(0);
+
+    auto put = [&](uint32_t code, uint32_t length) {
+        bits |= code << bitCount;
+        bitCount += length;
+        while (bitCount >= 8) {
+            out.push_back(bits & 0xFF);
+            bits >>= 8;
+            bitCount -= 8;
+            if (out.size() - block == 256) {
+                out[block] = 255;
+                block = out.size();
+                out.push_back(0);
+            }
+        }
+    };
+
+    std::fill(keys, keys + gif_lzw_table, -1);
+    put(clearCode, codeSize);
+
+    int32_t current = indices[0];
+    for (size_t i = 1; i < size; i++) {
+        uint32_t next = indices[i];
+        int32_t key = current << 8 | next;
+        uint32_t slot = (static_cast<uint32_t>(key) * 2654435761u) >> 19;
+
+        while (keys[slot] >= 0 && keys[slot] != key) {
+            slot = (slot + 1) & (gif_lzw_table - 1);
+        }
+        if (keys[slot] == key) {
+            current = codes[slot];
+            continue;
+        }
+
+        put(current, codeSize);
+        keys[slot] = key;
+        codes[slot] = ++maxCode;
+        if (maxCode >= (1u << codeSize)) {
+            codeSize++;
+        }
+        if (maxCode == 4095) {
+            put(clearCode, codeSize);
+            std::fill(keys, keys + gif_lzw_table, -1);
+            codeSize = minCodeSize + 1;
+            maxCode = clearCode + 1;
+        }
+        current = next;
+    }
+
+    put(current, codeSize);
+    put(clearCode, codeSize);
+    put(clearCode + 1, minCodeSize + 1);
+    if (bitCount) {
+        put(0, 8 - bitCount);
+    }
+
+    if (out.size() - block > 1) {
+        out[block] = out.size() - block - 1;
+        out.push_back(0);
+    } else {
+        out[block] = 0;
+    }
+}
+
+bool lcd_gif_write_frame(lcd_gif_writer *writer, const uint32_t *pixels, unsigned int delay) {
+    unsigned int x0 = gif_width, x1 = 0, y0 = gif_height, y1 = 0;
+    bool reuse = true;
+
+    if (!writer->file) {
+        return false;
+    }
+
+    // Bounding rectangle of the pixels that changed since the last frame
+    if (writer->first) {
+        x0 = y0 = 0;
+        x1 = gif_width;
+        y1 = gif_height;
+    } else {
+        for (unsigned int y = 0; y < gif_height; y++) {
+            const uint32_t *row = pixels + y * gif_width;
+            const uint32_t *last = writer->last.data() + y * gif_width;
+            unsigned int left = 0, right = gif_width;
+            if (!memcmp(row, last, gif_width * sizeof(uint32_t))) {
+                continue;
+            }
+            while (row[left] == last[left]) {
+                left++;
+            }
+            while (row[right - 1] == last[right - 1]) {
+                right--;
+            }
+            x0 = std::min(x0, left);
+            x1 = std::max(x1, right);
+            y0 = std::min(y0, y);
+            y1 = y + 1;
+        }
+    }
+
+    // Nothing changed: a single transparent pixel still carries the delay
+    if (y0 >= y1) {
+        x0 = y0 = 0;
+        x1 = y1 = 1;
+    }
+
+    unsigned int width = x1 - x0, height = y1 - y0;
+
+    for (unsigned int y = y0; y < y1 && reuse; y++) {
+        const uint32_t *row = pixels + y * gif_width;
+        const uint32_t *last = writer->last.data() + y * gif_width;
+        for (unsigned int x = x0; x < x1; x++) {
+            if ((writer->first || row[x] != last[x]) && writer->stamp[gif_key(row[x])] != writer->generation) {
+                reuse = false;
+                break;
+            }
+        }
+    }
+    if (!reuse || !writer->generation) {
+        gif_build_palette(writer, pixels, x0, y0, width, height);
+    }
+
+    writer->depth = 1;
+    while ((1u << writer->depth) < writer->count + 1) {
+        writer->depth++;
+    }
+
+    uint8_t *indices = writer->indices.data();
+    for (unsigned int y = y0; y < y1; y++) {
+        const uint32_t *row = pixels + y * gif_width;
+        uint32_t *last = writer->last.data() + y * gif_width;
+        for (unsigned int x = x0; x < x1; x++) {
+            *indices++ = (writer->first || row[x] != last[x]) ? writer->map[gif_key(row[x])] : 0;
+        }
+        memcpy(last + x0, row + x0, width * sizeof(uint32_t));
+    }
+    writer->first = false;
+
+    std::vector<uint8_t> &out = writer->out;
+    out.clear();
+
+    // Graphics control extension: keep the previous frame, index 0 is transparent
+    out.insert(out.end(), { 0x21, 0xF9, 0x04, 0x05 });
+    gif_put16(out, delay);
+    out.insert(out.end(), { 0, 0 });
+
+    // Image descriptor with a local color table
+    out.push_back(0x2C);
+    gif_put16(out, x0);
+    gif_put16(out, y0);
+    gif_put16(out, width);
+    gif_put16(out, height);
+    out.push_back(0x80 | (writer->depth - 1));
+    for (unsigned int i = 0; i < (1u << writer->depth); i++) {
+        uint32_t color = i && i <= writer->count ? writer->rgb[i] : 0;
+        out.push_back(color & 0xFF);
+        out.push_back(color >> 8 & 0xFF);
+        out.push_back(color >> 16 & 0xFF);
+    }
+
+    unsigned int minCodeSize = std::max(writer->depth, 2u);
+    out.push_back(minCodeSize);
+    gif_compress(writer, width * height, minCodeSize);
+
+    return fwrite(out.data(), 1, out.size(), writer->file) == out.size();
+}
+
+bool lcd_gif_end(lcd_gif_writer *writer) {
+    bool ok;
+
+    if (!writer->file) {
+        return false;
+    }
+
+    fputc(0x3B, writer->file);
+    ok = !ferror(writer->file);
+    ok &= !fclose(writer->file);
+    writer->file = NULL;
+
+    std::vector<uint32_t>().swap(writer->last);
+    std::vector<uint8_t>().swap(writer->indices);
+    std::vector<uint8_t>().swap(writer->map);
+    std::vector<uint32_t>().swap(writer->stamp);
+    std::vector<uint32_t>().swap(writer->counts);
+    std::vector<uint32_t>().swap(writer->samples);
+
+    return ok;
+}
@@ -0,0 +1,45 @@
+#ifndef LCDGIF_H
+#define LCDGIF_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <vector>
+
+// GIF writer specialised for 320x240 LCD frames. Every color the core produces comes from a 5:6:5 value,
+// so palettes are built from exact RGB565 histograms and only the changed rectangle of each frame is stored.
+struct lcd_gif_writer {
+    FILE *file;
+    bool first;
+
+    std::vector<uint32_t> last;     // previous source frame, for finding what changed
+    std::vector<uint8_t> indices;   // palette indices of the rectangle being encoded
+    std::vector<uint8_t> out;       // encoded frame, written with a single fwrite
+
+    // Current palette; entry 0 is transparent and marks pixels that did not change
+    uint32_t rgb[256];
+    uint16_t keys[256];
+    unsigned int count;
+    unsigned int depth;
+    bool exact;
+
+    // Palette index of every RGB565 key, valid where stamp matches generation
+    std::vector<uint8_t> map;
+    std::vector<uint32_t> stamp;
+    uint32_t generation;
+
+    // Scratch space for building a new palette
+    std::vector<uint32_t> counts;
+    std::vector<uint32_t> samples;
+    std::vector<uint16_t> distinct;
+
+    // Hashed LZW dictionary: (prefix << 8 | index) and the code assigned to it
+    std::vector<int32_t> lzwKeys;
+    std::vector<uint16_t> lzwCodes;
+};
+
+bool lcd_gif_begin(lcd_gif_writer *writer, const char *filename, bool animated);
+bool lcd_gif_write_frame(lcd_gif_writer *writer, const uint32_t *pixels, unsigned int delay);
+bool lcd_gif_end(lcd_gif_writer *writer);
+
+#endif
@@ -25,8 +25,8 @@ void DataWidget::updateAllHighlights() {
 QString DataWidget::getSelectedAddress() {
   QTextCursor c = textCursor();
   c.movePosition(QTextCursor::StartOfLine, QTextCursor::MoveAnchor);
-  c.setPosition(c.position()+6, QTextCursor::KeepAnchor); // +6 == size of the address
-                                                          // See MainWindow::drawNextDisassembleLine() for details
+  c.setPosition(c.position()+6, QTextCursor::KeepAnchor); // +6 == size of the address,
+                                                          // which starts every line
   return c.selectedText();
 }
 
@@ -0,0 +1,482 @@
+#include <cctype>
+
+#include <QApplication>
+#include <QKeyEvent>
+#include <QPainter>
+#include <QScrollBar>
+
+#include "disasmwidget.h"
+
+// Past the last address; line starts at or beyond this don't exist
+static const uint32_t disasmEnd = 0x1000000;
+
+// How far before a block decoding starts when the block before it isn't known. Code falls back into step
+// with the real instruction boundaries within a few instructions
+static const uint32_t disasmResync = 0x40;
+
+static bool operator==(const DisasmLine &a, const DisasmLine &b) {
+    return a.address == b.address && a.label == b.label;
+}
+
+// A label comes before the instruction at its address
+static bool operator<(const DisasmLine &a, const DisasmLine &b) {
+    return a.address < b.address || (a.address == b.address && a.label && !b.label);
+}
+
+DisasmWidget::DisasmWidget(QWidget *par) : QAbstractScrollArea(par) {
+    _blockStarts.resize(disasmEnd >> 8);
+    resetIndex();
+
+#ifdef Q_OS_WIN32
+    setFont(QFont("Courier", 10));
+#else
+    setFont(QFont("Monospace", 10));
+#endif
+
+    setContextMenuPolicy(Qt::CustomContextMenu);
+    setFocusPolicy(Qt::StrongFocus);
+    verticalScrollBar()->setRange(0, disasmEnd - 1);
+    verticalScrollBar()->setSingleStep(1);
+
+    connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &DisasmWidget::adjust);
+    connect(verticalScrollBar(), &QScrollBar::actionTriggered, this, &DisasmWidget::scrollAction);
+    connect(horizontalScrollBar(), &QScrollBar::valueChanged, this, &DisasmWidget::adjust);
+}
+
+void DisasmWidget::setFont(const QFont &font_) {
+    QWidget::setFont(font_);
+    _pxCharWidth = fontMetrics().width(QLatin1Char('D'));
+    _pxCharHeight = fontMetrics().height();
+    adjust();
+}
+
+void DisasmWidget::setMode(bool adl, bool dataColumn, bool cyclesColumn) {
+    if (adl != _adl) {
+        _adl = adl;
+        resetIndex();
+    }
+    _dataColumn = dataColumn;
+    _cyclesColumn = cyclesColumn;
+}
+
+// Memory may have changed since the last time, so the boundaries are found again
+void DisasmWidget::setAddress(uint32_t address, bool center) {
+    address &= 0xFFFFFF;
+    _anchor = address;
+    _active = true;
+    resetIndex();
+
+    _selected = _selectedFrom = { address, false };
+    _top = lineAt(address);
+    if (center) {
+        for (int i = _rowsShown / 2; i > 0 && lineBefore(_top); i--);
+    }
+
+    _value = _top.address;
+    verticalScrollBar()->setValue(static_cast<int>(_value));
+    fillRows();
+    viewport()->update();
+}
+
+QString DisasmWidget::getSelectedAddress() {
+    return QString::number(_selected.address, 16).rightJustified(6, '0').toUpper();
+}
+
+/* Instruction boundaries */
+void DisasmWidget::resetIndex() {
+    std::fill(_blockStarts.begin(), _blockStarts.end(), -1);
+}
+
+uint32_t DisasmWidget::nextStart(uint32_t address) {
+    disasm.adl = _adl;
+    disasm.base_address = static_cast<int32_t>(address);
+    disassembleInstruction();
+
+    uint32_t next = static_cast<uint32_t>(disasm.new_address);
+    if (address < _anchor && next > _anchor) {
+        next = _anchor;
+    }
+    return next;
+}
+
+uint32_t DisasmWidget::blockStart(uint32_t block) {
+    int32_t &start = _blockStarts[block];
+    if (start < 0) {
+        uint32_t begin = block << 8;
+        uint32_t address;
+        if (block && _blockStarts[block - 1] >= 0) {
+            address = static_cast<uint32_t>(_blockStarts[block - 1]);
+        } else {
+            uint32_t low = begin > disasmResync ? begin - disasmResync : 0;
+            address = low;
+            // An instruction the ROM analysis found is a real boundary to start from
+            for (uint32_t i = begin + 1; i-- > low;) {
+                uint8_t flags = analysis_flags(i);
+                if ((flags & ANALYSIS_START) && !(flags & ANALYSIS_ADL) == !_adl) {
+                    address = i;
+                    break;
+                }
+            }
+        }
+        while (address < begin) {
+            address = nextStart(address);
+        }
+        start = static_cast<int32_t>(address);
+    }
+    return static_cast<uint32_t>(start);
+}
+
+uint32_t DisasmWidget::startAtOrAfter(uint32_t address) {
+    uint32_t start = blockStart(address >> 8);
+    while (start < address) {
+        start = nextStart(start);
+    }
+    return start;
+}
+
+uint32_t DisasmWidget::startBefore(uint32_t address) {
+    uint32_t block = address >> 8;
+    uint32_t start, next;
+
+    while ((start = blockStart(block)) >= address) {
+        if (!block--) {
+            return disasmEnd;
+        }
+    }
+    while ((next = nextStart(start)) < address) {
+        start = next;
+    }
+    return start;
+}
+
+/* Lines */
+// Functions the ROM analysis found get a label even without a symbol
+bool DisasmWidget::isFunction(uint32_t address) {
+    return (analysis_flags(address) & (ANALYSIS_FUNCTION | ANALYSIS_START)) == (ANALYSIS_FUNCTION | ANALYSIS_START);
+}
+
+DisasmLine DisasmWidget::lineAt(uint32_t address) {
+    return { address, symbols_name(address) || isFunction(address) };
+}
+
+bool DisasmWidget::lineAfter(DisasmLine &line) {
+    if (line.label) {
+        line.label = false;
+        return true;
+    }
+    uint32_t next = nextStart(line.address);
+    if (next >= disasmEnd) {
+        return false;
+    }
+    line = lineAt(next);
+    return true;
+}
+
+bool DisasmWidget::lineBefore(DisasmLine &line) {
+    if (!line.label && lineAt(line.address).label) {
+        line.label = true;
+        return true;
+    }
+    if (!line.address) {
+        return false;
+    }
+    uint32_t prev = startBefore(line.address);
+    if (prev >= disasmEnd) {
+        return false;
+    }
+    line = { prev, false };
+    return true;
+}
+
+DisasmRow DisasmWidget::decodeRow(const DisasmLine &line) {
+    DisasmRow row;
+    row.line = line;
+
+    if (line.label) {
+        const char *name = symbols_name(line.address);
+        row.column = (name ? QString::fromLatin1(name) : QStringLiteral("sub_") + QString::number(line.address, 16).rightJustified(6, '0').toUpper()) + QLatin1Char(':');
+        row.read = row.write = row.exec = row.runUntil = row.pc = false;
+        return row;
+    }
+
+    disasm.adl = _adl;
+    disasm.base_address = static_cast<int32_t>(line.address);
+    disassembleInstruction();
+
+    if (_dataColumn) {
+        row.column = QString::fromLatin1(disasm.instruction.data).leftJustified(12, ' ');
+    }
+    row.opcode = QString::fromLatin1(disasm.instruction.opcode) + QString::fromLatin1(disasm.instruction.mode_suffix);
+    row.arguments = QString::fromLatin1(disasm.instruction.arguments);
+    if (disasm.instruction.cycles) {
+        row.cycles = QString::number(disasm.instruction.cycles);
+        if (disasm.instruction.cycles_taken) {
+            row.cycles += QLatin1Char('/') + QString::number(disasm.instruction.cycles_taken);
+        }
+    }
+    row.read = disasmHighlight.hit_read_breakpoint;
+    row.write = disasmHighlight.hit_write_breakpoint;
+    row.exec = disasmHighlight.hit_exec_breakpoint;
+    row.runUntil = disasmHighlight.hit_run_breakpoint;
+    row.pc = disasmHighlight.hit_pc;
+    return row;
+}
+
+int DisasmWidget::rowOf(const DisasmLine &line) {
+    for (int i = 0; i < _rows.size(); i++) {
+        if (_rows.at(i).line == line) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool DisasmWidget::isSelected(const DisasmLine &line) {
+    return _selected < _selectedFrom ? !(line < _selected) && !(_selectedFrom < line)
+                                     : !(line < _selectedFrom) && !(_selected < line);
+}
+
+// Moves the cursor, or drags the selection along with it, and adds up the selected instructions
+void DisasmWidget::select(const DisasmLine &line, bool extend) {
+    _selected = line;
+    if (!extend) {
+        _selectedFrom = line;
+    }
+
+    DisasmLine at = _selected < _selectedFrom ? _selected : _selectedFrom;
+    DisasmLine last = _selected < _selectedFrom ? _selectedFrom : _selected;
+    int instructions = 0;
+    quint64 cycles = 0, taken = 0;
+    do {
+        if (!at.label) {
+            disasm.adl = _adl;
+            disasm.base_address = static_cast<int32_t>(at.address);
+            disassembleInstruction();
+            instructions++;
+            cycles += disasm.instruction.cycles;
+            taken += disasm.instruction.cycles_taken ? disasm.instruction.cycles_taken : disasm.instruction.cycles;
+        }
+    } while (at < last && lineAfter(at));
+
+    emit selectionCycles(instructions, cycles, taken);
+}
+
+void DisasmWidget::scrollLines(int lines) {
+    for (; lines > 0 && lineAfter(_top); lines--);
+    for (; lines < 0 && lineBefore(_top); lines++);
+
+    _value = _top.address;
+    if (verticalScrollBar()->value() != static_cast<int>(_value)) {
+        verticalScrollBar()->setValue(static_cast<int>(_value));
+    } else {
+        fillRows();
+        viewport()->update();
+    }
+}
+
+void DisasmWidget::fillRows() {
+    DisasmLine line = _top;
+
+    _rows.clear();
+    _columns = 0;
+    for (int i = 0; i <= _rowsShown; i++) {
+        DisasmRow row = decodeRow(line);
+        _columns = qMax(_columns, 13 + (_cyclesColumn ? 9 : 0) + row.column.size() + 2 + row.opcode.size() + 1 + row.arguments.size());
+        _rows.append(row);
+        if (!lineAfter(line)) {
+            break;
+        }
+    }
+
+    horizontalScrollBar()->setRange(0, qMax(0, _columns * _pxCharWidth - viewport()->width()));
+    horizontalScrollBar()->setPageStep(viewport()->width());
+}
+
+/* Slots */
+void DisasmWidget::adjust() {
+    _rowsShown = viewport()->height() / _pxCharHeight;
+
+    // Memory is only looked at while the emulation is stopped in the debugger
+    if (!_active || !isEnabled()) {
+        viewport()->update();
+        return;
+    }
+
+    uint32_t value = static_cast<uint32_t>(verticalScrollBar()->value());
+    if (value != _value) {
+        uint32_t start = startAtOrAfter(value);
+        _value = value;
+        if (start < disasmEnd) {
+            _top = lineAt(start);
+        }
+    }
+    verticalScrollBar()->setPageStep(qMax(1, _rowsShown * 3));
+
+    fillRows();
+    viewport()->update();
+}
+
+void DisasmWidget::scrollAction(int action) {
+    switch (action) {
+        case QAbstractSlider::SliderSingleStepAdd:
+            scrollLines(1);
+            break;
+        case QAbstractSlider::SliderSingleStepSub:
+            scrollLines(-1);
+            break;
+        case QAbstractSlider::SliderPageStepAdd:
+            scrollLines(qMax(1, _rowsShown - 1));
+            break;
+        case QAbstractSlider::SliderPageStepSub:
+            scrollLines(-qMax(1, _rowsShown - 1));
+            break;
+        default:
+            return;
+    }
+    verticalScrollBar()->setSliderPosition(static_cast<int>(_value));
+}
+
+/* Handle events */
+void DisasmWidget::keyPressEvent(QKeyEvent *event) {
+    DisasmLine line = _selected;
+    bool extend = event->modifiers() & Qt::ShiftModifier;
+    int row;
+
+    switch (event->key()) {
+        case Qt::Key_Up:
+            if (lineBefore(line)) {
+                select(line, extend);
+                if (rowOf(_selected) < 0) {
+                    scrollLines(-1);
+                }
+            }
+            break;
+        case Qt::Key_Down:
+            if (lineAfter(line)) {
+                select(line, extend);
+                row = rowOf(_selected);
+                if (row < 0 || row >= _rowsShown) {
+                    scrollLines(1);
+                }
+            }
+            break;
+        case Qt::Key_PageUp:
+            scrollLines(-qMax(1, _rowsShown - 1));
+            break;
+        case Qt::Key_PageDown:
+            scrollLines(qMax(1, _rowsShown - 1));
+            break;
+        default:
+            QAbstractScrollArea::keyPressEvent(event);
+            return;
+    }
+    viewport()->update();
+}
+
+void DisasmWidget::mousePressEvent(QMouseEvent *event) {
+    int row = event->pos().y() / _pxCharHeight;
+    if (row >= 0 && row < _rows.size()) {
+        select(_rows.at(row).line, event->modifiers() & Qt::ShiftModifier);
+        viewport()->update();
+    }
+    QAbstractScrollArea::mousePressEvent(event);
+}
+
+void DisasmWidget::wheelEvent(QWheelEvent *event) {
+    _wheelDelta += event->angleDelta().y();
+    int steps = _wheelDelta / 120;
+    if (steps) {
+        _wheelDelta -= steps * 120;
+        scrollLines(-steps * QApplication::wheelScrollLines());
+    }
+    event->accept();
+}
+
+void DisasmWidget::resizeEvent(QResizeEvent *) {
+    adjust();
+}
+
+int DisasmWidget::drawToken(QPainter &painter, int x, int y, const QString &text, const QColor &color) {
+    painter.setPen(color);
+    painter.drawText(x, y, text);
+    return x + text.size() * _pxCharWidth;
+}
+
+void DisasmWidget::paintEvent(QPaintEvent *event) {
+    QPainter painter(viewport());
+    QFont bold = font();
+    const QColor text = viewport()->palette().color(QPalette::Text);
+    const QColor hex(Qt::darkGreen), dec(Qt::blue), paren(0x66, 0, 0);
+    int pxOfsX = horizontalScrollBar()->value();
+
+    bold.setBold(true);
+    painter.fillRect(event->rect(), viewport()->palette().color(QPalette::Base));
+
+    for (int i = 0; i < _rows.size(); i++) {
+        const DisasmRow &row = _rows.at(i);
+        int top = i * _pxCharHeight;
+        int y = top + fontMetrics().ascent();
+        int x = _pxCharWidth / 2 - pxOfsX;
+
+        if (isSelected(row.line)) {
+            painter.fillRect(0, top, viewport()->width(), _pxCharHeight, QColor(Qt::yellow).lighter(160));
+        } else if (row.pc) {
+            painter.fillRect(0, top, viewport()->width(), _pxCharHeight, QColor(Qt::red).lighter(160));
+        } else if (row.runUntil) {
+            painter.fillRect(0, top, viewport()->width(), _pxCharHeight, QColor(Qt::blue).lighter(160));
+        }
+
+        painter.setFont(bold);
+        x = drawToken(painter, x, y, QString::number(row.line.address, 16).rightJustified(6, '0').toUpper(), QColor(0x44, 0x44, 0x44));
+        painter.setFont(font());
+        x += _pxCharWidth;
+
+        // Read, write and execute breakpoints
+        if (row.read) {
+            drawToken(painter, x, y, QString(QChar(0x25CF)), QColor(0xA3, 0xFF, 0xA3));
+        }
+        if (row.write) {
+            drawToken(painter, x + _pxCharWidth, y, QString(QChar(0x25CF)), QColor(0xA3, 0xA3, 0xFF));
+        }
+        if (row.exec) {
+            drawToken(painter, x + 2 * _pxCharWidth, y, QString(QChar(0x25CF)), QColor(0xFF, 0xA3, 0xA3));
+        }
+        x += 4 * _pxCharWidth;
+
+        if (_cyclesColumn) {
+            x = drawToken(painter, x, y, row.cycles.rightJustified(7, ' '), QColor(Qt::darkGray));
+            x += 2 * _pxCharWidth;
+        }
+
+        x = drawToken(painter, x, y, row.column, text);
+        x += 2 * _pxCharWidth;
+        x = drawToken(painter, x, y, row.opcode, QColor(Qt::darkBlue));
+        x += _pxCharWidth;
+
+        // Numbers and parentheses stand out from registers and labels
+        const QString &args = row.arguments;
+        for (int pos = 0, len; pos < args.size(); pos += len) {
+            QChar c = args.at(pos);
+            QColor color = text;
+            len = 1;
+            if (c == QLatin1Char('$')) {
+                while (pos + len < args.size() && isxdigit(args.at(pos + len).toLatin1())) {
+                    len++;
+                }
+                if (len > 1) {
+                    color = hex;
+                }
+            } else if (c == QLatin1Char('(') || c == QLatin1Char(')')) {
+                color = paren;
+            } else if (!pos && c.isDigit()) {
+                color = dec;
+            } else {
+                while (pos + len < args.size() && args.at(pos + len) != QLatin1Char('$') &&
+                       args.at(pos + len) != QLatin1Char('(') && args.at(pos + len) != QLatin1Char(')')) {
+                    len++;
+                }
+            }
+            x = drawToken(painter, x, y, args.mid(pos, len), color);
+        }
+    }
+}
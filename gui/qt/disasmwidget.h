@@ -0,0 +1,93 @@
+#ifndef DISASMWIDGET_H
+#define DISASMWIDGET_H
+
+#include <QAbstractScrollArea>
+#include <QVector>
+
+#include <vector>
+
+#include "../../core/debug/disasm.h"
+#include "../../core/debug/symbols.h"
+#include "../../core/debug/analysis.h"
+
+// A line of the disassembly: the label above an address, or the instruction at it
+struct DisasmLine {
+    uint32_t address;
+    bool label;
+};
+
+struct DisasmRow {
+    DisasmLine line;
+    QString column;                             // data bytes, or the label
+    QString opcode;
+    QString arguments;
+    QString cycles;                             // carrying on, and taken when it can be
+    bool read, write, exec, runUntil, pc;
+};
+
+// Shows the whole address space, but only decodes the rows that are on screen
+class DisasmWidget : public QAbstractScrollArea {
+    Q_OBJECT
+
+public:
+    DisasmWidget(QWidget *parent = 0);
+
+    void setMode(bool adl, bool dataColumn, bool cyclesColumn);
+    void setAddress(uint32_t address, bool center);
+    QString getSelectedAddress();
+    virtual void setFont(const QFont &font);
+
+signals:
+    // Totals over the selected instructions, straight through and with every branch taken
+    void selectionCycles(int instructions, quint64 cycles, quint64 taken);
+
+protected:
+    void keyPressEvent(QKeyEvent *event);
+    void mousePressEvent(QMouseEvent *event);
+    void paintEvent(QPaintEvent *event);
+    void resizeEvent(QResizeEvent *);
+    void wheelEvent(QWheelEvent *event);
+
+private slots:
+    void adjust();                              // follow the scroll bars
+    void scrollAction(int action);              // scroll bar steps move by lines rather than bytes
+
+private:
+    // Instruction boundaries
+    void resetIndex();
+    uint32_t nextStart(uint32_t address);
+    uint32_t blockStart(uint32_t block);
+    uint32_t startAtOrAfter(uint32_t address);
+    uint32_t startBefore(uint32_t address);
+
+    // Lines
+    bool isFunction(uint32_t address);
+    DisasmLine lineAt(uint32_t address);
+    bool lineAfter(DisasmLine &line);
+    bool lineBefore(DisasmLine &line);
+    DisasmRow decodeRow(const DisasmLine &line);
+    int rowOf(const DisasmLine &line);
+    bool isSelected(const DisasmLine &line);
+    void select(const DisasmLine &line, bool extend);
+    void scrollLines(int lines);
+    void fillRows();
+    int drawToken(QPainter &painter, int x, int y, const QString &text, const QColor &color);
+
+    bool _active = false;                       // nothing is decoded before the first setAddress()
+    bool _adl = false;
+    bool _dataColumn = true;
+    bool _cyclesColumn = false;
+    uint32_t _anchor = 0;                       // always a line start, so the address that was asked for shows
+    uint32_t _value = 0;                        // scroll bar value the top line was found from
+    DisasmLine _top = { 0, false };
+    DisasmLine _selected = { 0, false };
+    DisasmLine _selectedFrom = { 0, false };    // the other end of the selection
+    std::vector<int32_t> _blockStarts;          // first line start in each 256 byte block, -1 until needed
+    QVector<DisasmRow> _rows;                   // the rows on screen
+    int _pxCharWidth, _pxCharHeight;
+    int _rowsShown = 0;                         // rows that fit entirely
+    int _columns = 0;                           // widest row shown, in characters
+    int _wheelDelta = 0;
+};
+
+#endif
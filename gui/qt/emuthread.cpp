@@ -32,6 +32,7 @@
 #include "../../core/link.h"
 #include "../../core/debug/debug.h"
 #include "../../core/debug/disasm.h"
+#include "../../core/debug/analysis.h"
 #include "../../core/debug/stepping.h"
 
 EmuThread *emu_thread = nullptr;
@@ -97,10 +98,28 @@ void gui_entered_send_state(bool entered) {
     }
 }
 
+static void gui_lcd_frame(void) {
+    gif_new_frame();
+    emu_thread->lcdFrame();
+}
+
+// The frame that ended the wait goes along, since emulation carries on while the GUI gets to the signal
+static void gui_lcd_wait_done(lcd_wait_result_t result, uint64_t hash) {
+    const lcd_frame_t *frame = lcd_frame_published();
+    QImage image(reinterpret_cast<const uchar*>(frame->pixels), 320, 240, QImage::Format_RGBA8888);
+    emit emu_thread->screenWaitDone(result, hash, image.copy());
+}
+
+static void gui_analysis_done(void) {
+    emit emu_thread->analysisDone();
+}
+
 EmuThread::EmuThread(QObject *p) : QThread(p) {
     assert(emu_thread == nullptr);
     emu_thread = this;
-    lcd_event_gui_callback = gif_new_frame;
+    lcd_event_gui_callback = gui_lcd_frame;
+    lcd_wait_gui_callback = gui_lcd_wait_done;
+    analysis_gui_callback = gui_analysis_done;
     speed = actualSpeed = 100;
     updateTimer.start();
     lastTime= updateTimer.elapsed();
@@ -181,6 +200,31 @@ void EmuThread::doStuff() {
         emit saved(success);
     }
 
+    if (streamStop) {
+        streamStop = false;
+        lcd_stream_stop();
+    }
+
+    if (streamStart) {
+        streamStart = false;
+        lcd_stream_start(streamPath.c_str(), streamFormat);
+    }
+
+    if (shareStop) {
+        shareStop = false;
+        shm_export_stop();
+    }
+
+    if (shareStart) {
+        shareStart = false;
+        shm_export_start(shareName.c_str());
+    }
+
+    if (screenWaitStart) {
+        screenWaitStart = false;
+        lcd_wait_start(&screenWait);
+    }
+
     if (enterSendState || enterReceiveState) {
         enterReceiveState = enterSendState = false;
         enterVariableLink();
@@ -194,6 +238,17 @@ void EmuThread::doStuff() {
     lastTime += updateTimer.elapsed() - cur_time;
 }
 
+// Called on every completed LCD frame; at most one notification is queued until the GUI handles it
+void EmuThread::lcdFrame() {
+    if (lcdFramePending.testAndSetOrdered(0, 1)) {
+        emit lcdFrameReady();
+    }
+}
+
+void EmuThread::lcdFrameHandled() {
+    lcdFramePending.storeRelease(0);
+}
+
 void EmuThread::sendActualSpeed() {
     if(!calc_is_off()) {
         emit actualSpeedChanged(actualSpeed);
@@ -288,3 +343,27 @@ void EmuThread::saveRomImage(QString path) {
     exportRomPath = QDir::toNativeSeparators(path).toStdString();
     saveRom = true;
 }
+
+void EmuThread::startStream(QString path, lcd_stream_format_t format) {
+    streamPath = QDir::toNativeSeparators(path).toStdString();
+    streamFormat = format;
+    streamStart = true;
+}
+
+void EmuThread::stopStream() {
+    streamStop = true;
+}
+
+void EmuThread::startShare(QString name) {
+    shareName = name.toStdString();
+    shareStart = true;
+}
+
+void EmuThread::stopShare() {
+    shareStop = true;
+}
+
+void EmuThread::startScreenWait(const lcd_wait_t &wait) {
+    screenWait = wait;
+    screenWaitStart = true;
+}
@@ -4,11 +4,16 @@
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QAtomicInt>
+#include <QtGui/QImage>
 
 #include <chrono>
 
 #include "../../core/asic.h"
 #include "../../core/debug/debug.h"
+#include "../../core/lcdstream.h"
+#include "../../core/lcdhash.h"
+#include "../../core/shmexport.h"
 
 extern QTimer speedUpdateTimer;
 
@@ -19,6 +24,8 @@ public:
 
     void doStuff();
     void throttleTimerWait();
+    void lcdFrame();
+    void lcdFrameHandled();
 
     std::string rom, imagePath;
     volatile bool waitForLink = false;
@@ -37,6 +44,9 @@ signals:
 
     // Status
     void actualSpeedChanged(int);
+    void lcdFrameReady();
+    void screenWaitDone(int result, quint64 hash, QImage frame);
+    void analysisDone();
     void isBusy(bool busy);
 
     // Save/Restore state
@@ -72,6 +82,17 @@ public slots:
     void save(QString);
     void saveRomImage(QString);
 
+    // Frame streaming
+    void startStream(QString, lcd_stream_format_t);
+    void stopStream();
+
+    // Shared memory
+    void startShare(QString);
+    void stopShare();
+
+    // Screen waits
+    void startScreenWait(const lcd_wait_t &);
+
     // Speed
     void sendActualSpeed();
 
@@ -89,6 +110,16 @@ private:
     volatile bool saveImage = false;
     volatile bool saveRom = false;
     volatile bool doRestore = false;
+    std::string streamPath;
+    lcd_stream_format_t streamFormat;
+    volatile bool streamStart = false;
+    volatile bool streamStop = false;
+    std::string shareName;
+    volatile bool shareStart = false;
+    volatile bool shareStop = false;
+    lcd_wait_t screenWait;
+    volatile bool screenWaitStart = false;
+    QAtomicInt lcdFramePending;
 };
 
 // For friends
@@ -0,0 +1,192 @@
+#include "lcdscaler.h"
+
+#include <cmath>
+#include <cstring>
+
+#include <QtCore/QtGlobal>
+
+// Map every output pixel onto the source; sharp bilinear only blends across the band where two source pixels meet
+static void buildMap(std::vector<int> &src, std::vector<uint32_t> &weight, int out, int in, bool smooth) {
+    double s = static_cast<double>(out) / in;
+
+    src.resize(out);
+    weight.resize(out);
+
+    for (int i = 0; i < out; i++) {
+        double u = (i + 0.5) / s;
+        int texel = qMin(static_cast<int>(u), in - 1);
+        int index = texel;
+        int w = 0;
+
+        if (smooth && s > 1) {
+            double range = 0.5 - 0.5 / s;
+            double dist = u - texel - 0.5;
+            double p = texel + (dist - qBound(-range, dist, range)) * s;
+            index = static_cast<int>(std::floor(p));
+            w = qRound((p - index) * 256);
+            if (w >= 256) {
+                index++;
+                w = 0;
+            }
+            if (index < 0) {
+                index = 0;
+                w = 0;
+            } else if (index >= in - 1) {
+                index = in - 1;
+                w = 0;
+            }
+        }
+        src[i] = index;
+        weight[i] = w;
+    }
+}
+
+static inline uint32_t blend(uint32_t a, uint32_t b, uint32_t w) {
+    uint32_t rb = ((a & 0xFF00FF) * (256 - w) + (b & 0xFF00FF) * w) >> 8 & 0xFF00FF;
+    uint32_t ga = ((a >> 8 & 0xFF00FF) * (256 - w) + (b >> 8 & 0xFF00FF) * w) & 0xFF00FF00;
+    return rb | ga;
+}
+
+void LCDScaler::setSmooth(bool enable) {
+    if (smooth != enable) {
+        smooth = enable;
+        valid = false;
+    }
+}
+
+void LCDScaler::invalidate() {
+    valid = false;
+}
+
+void LCDScaler::setup(const QSize &size, int ratio) {
+    int width = size.width(), height = size.height();
+
+    if (image.size() != size) {
+        image = QImage(size, QImage::Format_RGBA8888);
+    }
+    image.setDevicePixelRatio(ratio);
+
+    xfactor = width % 320 ? 0 : width / 320;
+    yfactor = height % 240 ? 0 : height / 240;
+    if (!xfactor || !yfactor) {
+        buildMap(xsrc, xweight, width, 320, smooth);
+        buildMap(ysrc, yweight, height, 240, smooth);
+    }
+
+    row.resize(320);
+    hrows.clear();
+    if (smooth && (!xfactor || !yfactor)) {
+        hrows.resize(240 * width);
+    }
+}
+
+const QImage &LCDScaler::scale(const lcd_frame_t *frame, const QSize &size, int ratio) {
+    bool full = !valid || image.size() != size || image.devicePixelRatio() != ratio || frame->brightness != brightness;
+
+    if (size.isEmpty()) {
+        return image;
+    }
+    if (full) {
+        setup(size, ratio);
+    } else if (frame->seq == seq) {
+        return image;
+    }
+
+    if (full || frame->seq != seq + 1) {
+        scaleRows(frame, 0, 240);
+    } else {
+        scaleRows(frame, frame->dirty.y, frame->dirty.y + frame->dirty.height);
+    }
+
+    seq = frame->seq;
+    brightness = frame->brightness;
+    valid = true;
+    return image;
+}
+
+void LCDScaler::scaleRows(const lcd_frame_t *frame, int first, int last) {
+    if (first >= last) {
+        return;
+    }
+    if (xfactor && yfactor) {
+        scaleInteger(frame, first, last);
+    } else if (smooth) {
+        scaleSmooth(frame, first, last);
+    } else {
+        scaleNearest(frame, first, last);
+    }
+}
+
+// Widen each row in the core and repeat it for the remaining output rows
+void LCDScaler::scaleInteger(const lcd_frame_t *frame, int first, int last) {
+    int stride = image.bytesPerLine();
+    size_t bytes = image.width() * sizeof(uint32_t);
+    uchar *bits = image.bits();
+
+    for (int y = first; y < last; y++) {
+        uchar *dst = bits + y * yfactor * stride;
+        lcd_scale_row(reinterpret_cast<uint32_t*>(dst), frame->pixels + y * 320, xfactor, frame->brightness);
+        for (int k = 1; k < yfactor; k++) {
+            memcpy(dst + k * stride, dst, bytes);
+        }
+    }
+}
+
+void LCDScaler::scaleNearest(const lcd_frame_t *frame, int first, int last) {
+    int width = image.width(), height = image.height();
+    int stride = image.bytesPerLine();
+    uchar *bits = image.bits();
+    int prev = -1;
+
+    for (int y = 0; y < height; y++) {
+        int src = ysrc[y];
+        uchar *dst = bits + y * stride;
+        if (src < first || src >= last) {
+            continue;
+        }
+        if (src == prev) {
+            memcpy(dst, dst - stride, width * sizeof(uint32_t));
+            continue;
+        }
+        lcd_scale_row(row.data(), frame->pixels + src * 320, 1, frame->brightness);
+        uint32_t *out = reinterpret_cast<uint32_t*>(dst);
+        for (int x = 0; x < width; x++) {
+            out[x] = row[xsrc[x]];
+        }
+        prev = src;
+    }
+}
+
+// Filter the changed rows horizontally, then blend every output row that reads from one of them
+void LCDScaler::scaleSmooth(const lcd_frame_t *frame, int first, int last) {
+    int width = image.width(), height = image.height();
+    int stride = image.bytesPerLine();
+    uchar *bits = image.bits();
+
+    for (int y = first; y < last; y++) {
+        uint32_t *out = hrows.data() + y * width;
+        lcd_scale_row(row.data(), frame->pixels + y * 320, 1, frame->brightness);
+        for (int x = 0; x < width; x++) {
+            int src = xsrc[x];
+            out[x] = xweight[x] ? blend(row[src], row[src + 1], xweight[x]) : row[src];
+        }
+    }
+
+    for (int y = 0; y < height; y++) {
+        int src = ysrc[y];
+        uint32_t w = yweight[y];
+        if (src >= last || src + (w ? 1 : 0) < first) {
+            continue;
+        }
+        uint32_t *out = reinterpret_cast<uint32_t*>(bits + y * stride);
+        const uint32_t *a = hrows.data() + src * width;
+        if (!w) {
+            memcpy(out, a, width * sizeof(uint32_t));
+        } else {
+            const uint32_t *b = a + width;
+            for (int x = 0; x < width; x++) {
+                out[x] = blend(a[x], b[x], w);
+            }
+        }
+    }
+}
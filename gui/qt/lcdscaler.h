@@ -0,0 +1,42 @@
+#ifndef LCDSCALER_H
+#define LCDSCALER_H
+
+#include <QtGui/QImage>
+
+#include <vector>
+
+#include "../../core/lcd.h"
+
+// Keeps a copy of the emulated screen at the size it is shown at, redoing only the rows that changed
+class LCDScaler {
+public:
+    const QImage &scale(const lcd_frame_t *frame, const QSize &size, int ratio);
+    void setSmooth(bool enable);
+    void invalidate();
+
+private:
+    void setup(const QSize &size, int ratio);
+    void scaleRows(const lcd_frame_t *frame, int first, int last);
+    void scaleInteger(const lcd_frame_t *frame, int first, int last);
+    void scaleNearest(const lcd_frame_t *frame, int first, int last);
+    void scaleSmooth(const lcd_frame_t *frame, int first, int last);
+
+    QImage image;
+    bool valid = false;
+    bool smooth = false;
+    uint32_t seq = 0;
+    uint8_t brightness = 0;
+
+    // Whole number scale factors, or 0 when the size is not a multiple of 320x240
+    int xfactor = 0;
+    int yfactor = 0;
+
+    // Source column and row of every output pixel, and the weight of the next one out of 256
+    std::vector<int> xsrc, ysrc;
+    std::vector<uint32_t> xweight, yweight;
+
+    std::vector<uint32_t> row;
+    std::vector<uint32_t> hrows;
+};
+
+#endif
@@ -23,10 +23,22 @@
 #include "qtframebuffer.h"
 #include "../../core/lcd.h"
 
+// Frames are timed by the emulation thread, so one can reach us a little before a whole emulated period has
+// passed on the host clock; holding presents a full period apart would then put off every other frame. Three
+// quarters of a period leaves room for that jitter; a present still needs a new frame, so it never runs ahead.
+static const qint64 presentPeriodPercent = 75;
+
+// Frames stop arriving once the LCD controller is disabled or the calculator is in ship mode, so this is the only way
+// the view finds out to show that; refresh() returns right away when nothing changed, so it costs next to nothing
+static const int panelPollMs = 250;
+
 LCDWidget::LCDWidget(QWidget *p) : QWidget(p) {
     lcdState = &lcd;
     setContextMenuPolicy(Qt::CustomContextMenu);
-    connect(&refreshTimer, SIGNAL(timeout()), this, SLOT(repaint()));
+    connect(&refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    connect(&presentTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    presentTimer.setSingleShot(true);
+    lastPresent.start();
 
     setAcceptDrops(true);
     // Default rate is 60 FPS
@@ -37,17 +49,103 @@ LCDWidget::~LCDWidget(){}
 
 void LCDWidget::paintEvent(QPaintEvent */*event*/) {
     QPainter painter(this);
-    paintFramebuffer(&painter, lcdState);
+    if (lcdState == &lcd && framebufferOn(lcdState)) {
+        // Blit a cached copy at the final size, with the backlight already applied
+        int ratio = devicePixelRatio();
+        painter.drawImage(QPoint(0, 0), scaler.scale(currentFrame(), size() * ratio, ratio));
+    } else {
+        paintFramebuffer(&painter, lcdState);
+    }
 }
 
-void LCDWidget::refreshRate(int newrate) {
+void LCDWidget::setSmoothScaling(bool enable) {
+    scaler.setSmooth(enable);
+    update();
+}
+
+bool LCDWidget::presentable() {
+    return isVisible() && !window()->isMinimized();
+}
+
+void LCDWidget::newFrame() {
+    if (lcdState != &lcd || !presentable()) {
+        return;
+    }
+
+    // Present at most once per emulated refresh, capped by the configured rate
+    qint64 interval = qMax<qint64>(lcd_frame_period() * presentPeriodPercent / 100, 1000000 / maxRate);
+    qint64 wait = (interval - lastPresent.nsecsElapsed() / 1000 + 999) / 1000;
+    if (wait > 0) {
+        if (!presentTimer.isActive()) {
+            presentTimer.start(static_cast<int>(wait));
+        }
+        return;
+    }
+    refresh();
+}
+
+void LCDWidget::refresh() {
+    if (!presentable()) {
+        return;
+    }
+
+    if (lcdState != &lcd) {
+        update();
+        return;
+    }
+
+    bool on = framebufferOn(lcdState);
+    if (on != lcdOn) {
+        lcdOn = on;
+        lastSeq = 0;
+        if (!on) {
+            update();
+            return;
+        }
+    }
+
+    // The one place a new frame is picked up; painting and captures then all use this one
+    const lcd_frame_t *frame = acquireFrame();
+    if (frame->seq == lastSeq) {
+        return;
+    }
+
+    // Only repaint what changed, unless frames were missed or the backlight changed
+    QRect dirty(0, 0, 320, 240);
+    if (frame->seq == lastSeq + 1 && frame->brightness == lastBrightness) {
+        dirty = QRect(frame->dirty.x, frame->dirty.y, frame->dirty.width, frame->dirty.height);
+    }
+    lastSeq = frame->seq;
+    lastBrightness = frame->brightness;
+    lastPresent.restart();
+
+    if (!dirty.isEmpty()) {
+        // Filtered output rows also read the neighbouring source rows
+        int top = qMax(dirty.top() - 1, 0) * height() / 240;
+        int bottom = (qMin(dirty.bottom() + 2, 240) * height() + 239) / 240;
+        update(0, top, width(), bottom - top);
+    }
+}
+
+void LCDWidget::updateTimer() {
     refreshTimer.stop();
-    refreshTimer.setInterval(1000 / newrate);
+    if (lcdState == &lcd) {
+        // Frames are presented from newFrame(); this only picks up the panel turning on or off
+        refreshTimer.setInterval(panelPollMs);
+    } else {
+        refreshTimer.setInterval(1000 / maxRate);
+    }
     refreshTimer.start();
 }
 
+void LCDWidget::refreshRate(int newrate) {
+    maxRate = qMax(newrate, 1);
+    updateTimer();
+}
+
 void LCDWidget::setLCD(lcd_state_t *lcdS) {
     lcdState = lcdS;
+    updateTimer();
 }
 
 void LCDWidget::mousePressEvent(QMouseEvent *e) {
@@ -3,8 +3,10 @@
 
 #include <QtWidgets/QWidget>
 #include <QtCore/QTimer>
+#include <QtCore/QElapsedTimer>
 
 #include "qtframebuffer.h"
+#include "lcdscaler.h"
 #include "../../core/lcd.h"
 
 class LCDWidget : public QWidget
@@ -15,15 +17,30 @@ class LCDWidget : public QWidget
       ~LCDWidget();
       void refreshRate(int newrate);
       void setLCD(lcd_state_t*);
+      void newFrame();
+      void setSmoothScaling(bool enable);
+
+  private slots:
+      void refresh();
 
   protected:
       virtual void mousePressEvent(QMouseEvent */*event*/) Q_DECL_OVERRIDE;
       virtual void paintEvent(QPaintEvent */*event*/) Q_DECL_OVERRIDE;
 
   private:
+      bool presentable();
+      void updateTimer();
+
       int lcdSize = 0;
+      int maxRate = 60;
       bool state_set = false;
+      bool lcdOn = false;
+      uint32_t lastSeq = 0;
+      uint8_t lastBrightness = 0;
       QTimer refreshTimer;
+      QTimer presentTimer;
+      QElapsedTimer lastPresent;
+      LCDScaler scaler;
       lcd_state_t *lcdState;
   };
 
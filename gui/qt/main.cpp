@@ -1,6 +1,9 @@
 #include <QtWidgets/QApplication>
+#include <QtCore/QCommandLineParser>
 #include <QtQml/QtQml>
 
+#include <cstdio>
+
 #include "mainwindow.h"
 #include "qmlbridge.h"
 
@@ -11,11 +14,94 @@ int main(int argc, char *argv[]) {
     QCoreApplication::setApplicationName(QStringLiteral("CEmu"));
     app.setAttribute(Qt::AA_UseHighDpiPixmaps);
 
+    // Screen waits for test scripts: the result and hash go to stdout, and the exit code is 0 if the wait was met,
+    // 1 if it timed out or the screenshot couldn't be saved, 2 for bad options and 3 if it was cancelled
+    QCommandLineParser parser;
+    QCommandLineOption waitHash(QStringLiteral("wait-hash"), QObject::tr("Run until the screen hashes to <hash>."), QStringLiteral("hash"));
+    QCommandLineOption waitChange(QStringLiteral("wait-change"), QObject::tr("Run until the screen changes."));
+    QCommandLineOption waitStable(QStringLiteral("wait-stable"), QObject::tr("Run until the screen stays the same for <frames> frames."), QStringLiteral("frames"));
+    QCommandLineOption waitRegion(QStringLiteral("wait-region"), QObject::tr("Only watch the region <x,y,width,height>."), QStringLiteral("region"));
+    QCommandLineOption waitTimeout(QStringLiteral("wait-timeout"), QObject::tr("Give up after <cycles> emulated CPU cycles."), QStringLiteral("cycles"));
+    QCommandLineOption waitScreenshot(QStringLiteral("wait-screenshot"), QObject::tr("Save the frame that ended the wait as a PNG to <file>."), QStringLiteral("file"));
+    QCommandLineOption perfJson(QStringLiteral("perf-json"), QObject::tr("Append the performance counters to <file> as JSON every second."), QStringLiteral("file"));
+    QCommandLineOption coverageReport(QStringLiteral("coverage"), QObject::tr("Gather code coverage and write it to <file> as an lcov report on exit."), QStringLiteral("file"));
+    QCommandLineOption coverageListing(QStringLiteral("listing"), QObject::tr("Report coverage on the code in the spasm listing <file>; can be given more than once."), QStringLiteral("file"));
+    QCommandLineOption stream(QStringLiteral("stream"), QObject::tr("Write every frame to <file>, which can be a named pipe."), QStringLiteral("file"));
+    QCommandLineOption streamFormat(QStringLiteral("stream-format"), QObject::tr("Stream frames as <format>: raw for RGB565 or y4m; by default y4m if the file ends in .y4m, raw otherwise."), QStringLiteral("format"));
+    parser.addHelpOption();
+    parser.addOptions({ waitHash, waitChange, waitStable, waitRegion, waitTimeout, waitScreenshot, perfJson, coverageReport, coverageListing, stream, streamFormat });
+    parser.process(app);
+
+    lcd_wait_t wait = {};
+    bool waiting = true, ok = true;
+    if (parser.isSet(waitHash)) {
+        wait.kind = LCD_WAIT_HASH;
+        wait.hash = parser.value(waitHash).toULongLong(&ok, 16);
+    } else if (parser.isSet(waitStable)) {
+        wait.kind = LCD_WAIT_STABLE;
+        wait.frames = parser.value(waitStable).toUInt(&ok);
+        ok = ok && wait.frames;
+    } else if (parser.isSet(waitChange)) {
+        wait.kind = LCD_WAIT_CHANGE;
+    } else {
+        waiting = false;
+    }
+    if (parser.isSet(waitRegion)) {
+        QStringList region = parser.value(waitRegion).split(QLatin1Char(','));
+        bool x, y, w, h;
+        ok = ok && region.size() == 4;
+        if (ok) {
+            wait.rect.x = region[0].toUInt(&x);
+            wait.rect.y = region[1].toUInt(&y);
+            wait.rect.width = region[2].toUInt(&w);
+            wait.rect.height = region[3].toUInt(&h);
+            ok = x && y && w && h;
+        }
+    }
+    if (parser.isSet(waitTimeout)) {
+        bool t;
+        wait.timeout = parser.value(waitTimeout).toULongLong(&t);
+        ok = ok && t;
+    }
+    if (!ok) {
+        fputs(qPrintable(QObject::tr("Invalid screen wait options.\n")), stderr);
+        return 2;
+    }
+
+    lcd_stream_format_t format = parser.value(stream).endsWith(QStringLiteral(".y4m"), Qt::CaseInsensitive) ? LCD_STREAM_Y4M : LCD_STREAM_RGB565;
+    if (parser.isSet(streamFormat)) {
+        QString name = parser.value(streamFormat).toLower();
+        if (name == QStringLiteral("y4m")) {
+            format = LCD_STREAM_Y4M;
+        } else if (name == QStringLiteral("raw")) {
+            format = LCD_STREAM_RGB565;
+        } else {
+            fputs(qPrintable(QObject::tr("Invalid stream format.\n")), stderr);
+            return 2;
+        }
+    }
+
     // Register QMLBridge for Keypad<->Emu communication
     qmlRegisterSingletonType<QMLBridge>("CE.emu", 1, 0, "Emu", qmlBridgeFactory);
 
     MainWindow EmuWin;
     EmuWin.show();
 
+    if (parser.isSet(perfJson)) {
+        EmuWin.logPerformance(parser.value(perfJson));
+    }
+
+    if (parser.isSet(coverageReport)) {
+        EmuWin.recordCoverage(parser.value(coverageReport), parser.values(coverageListing));
+    }
+
+    if (parser.isSet(stream)) {
+        EmuWin.streamTo(parser.value(stream), format);
+    }
+
+    if (waiting) {
+        EmuWin.waitForScreen(wait, parser.value(waitScreenshot));
+    }
+
     return app.exec();
 }
@@ -26,6 +26,8 @@
 #include <QtGui/QPixmap>
 
 #include <fstream>
+#include <algorithm>
+#include <vector>
 
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
@@ -36,6 +38,8 @@
 #include "qtframebuffer.h"
 #include "qtkeypadbridge.h"
 #include "searchwidget.h"
+#include "memscanwidget.h"
+#include "perfwidget.h"
 #include "basiccodeviewerwindow.h"
 
 #include "utils.h"
@@ -44,7 +48,9 @@
 #include "../../core/schedule.h"
 #include "../../core/debug/disasm.h"
 #include "../../core/link.h"
+#include "../../core/memsearch.h"
 #include "../../core/os/os.h"
+#include "../../core/perf.h"
 
 static const constexpr int WindowStateVersion = 0;
 
@@ -74,6 +80,7 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(&emu, &EmuThread::restored, this, &MainWindow::restored, Qt::QueuedConnection);
     connect(&emu, &EmuThread::saved, this, &MainWindow::saved, Qt::QueuedConnection);
     connect(&emu, &EmuThread::isBusy, this, &MainWindow::isBusy, Qt::QueuedConnection);
+    connect(&emu, &EmuThread::lcdFrameReady, this, &MainWindow::lcdFrameReady, Qt::QueuedConnection);
 
     // Console actions
     connect(ui->buttonConsoleclear, &QPushButton::clicked, ui->console, &QPlainTextEdit::clear);
@@ -86,6 +93,7 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(&emu, &EmuThread::raiseDebugger, this, &MainWindow::raiseDebugger, Qt::QueuedConnection);
     connect(&emu, &EmuThread::disableDebugger, this, &MainWindow::disableDebugger, Qt::QueuedConnection);
     connect(&emu, &EmuThread::sendDebugCommand, this, &MainWindow::processDebugCommand, Qt::QueuedConnection);
+    connect(&emu, &EmuThread::analysisDone, this, &MainWindow::analysisDone, Qt::QueuedConnection);
     connect(ui->buttonAddPort, &QPushButton::clicked, this, &MainWindow::addPort);
     connect(ui->buttonDeletePort, &QPushButton::clicked, this, &MainWindow::deletePort);
     connect(ui->buttonAddBreakpoint, &QPushButton::clicked, this, &MainWindow::addBreakpoint);
@@ -100,15 +108,52 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(this, &MainWindow::setDebugStepOutMode, &emu, &EmuThread::setDebugStepOutMode);
     connect(ui->buttonGoto, &QPushButton::clicked, this, &MainWindow::gotoPressed);
     connect(ui->disassemblyView, &QWidget::customContextMenuRequested, this, &MainWindow::disasmContextMenu);
+    connect(ui->disassemblyView, &DisasmWidget::selectionCycles, this, &MainWindow::showSelectionCycles);
     connect(ui->vatView, &QWidget::customContextMenuRequested, this, &MainWindow::vatContextMenu);
     connect(ui->opView, &QWidget::customContextMenuRequested, this, &MainWindow::opContextMenu);
     connect(ui->portView, &QTableWidget::itemChanged, this, &MainWindow::changePortValues);
     connect(ui->portView, &QTableWidget::itemPressed, this, &MainWindow::setPreviousPortValues);
     connect(ui->breakpointView, &QTableWidget::itemChanged, this, &MainWindow::changeBreakpointAddress);
     connect(ui->breakpointView, &QTableWidget::itemPressed, this, &MainWindow::setPreviousBreakpointAddress);
+    connect(ui->buttonProfileExact, &QPushButton::clicked, this, &MainWindow::profileExactPressed);
+    connect(ui->buttonProfileSample, &QPushButton::clicked, this, &MainWindow::profileSamplePressed);
+    connect(ui->buttonProfileStop, &QPushButton::clicked, this, &MainWindow::profileStopPressed);
+    connect(ui->buttonProfileExport, &QPushButton::clicked, this, &MainWindow::exportProfile);
+    connect(ui->buttonTraceStart, &QPushButton::clicked, this, &MainWindow::traceStartPressed);
+    connect(ui->buttonTraceStop, &QPushButton::clicked, this, &MainWindow::traceStopPressed);
+    connect(ui->buttonTraceSave, &QPushButton::clicked, this, &MainWindow::saveTrace);
+    connect(ui->buttonTracePath, &QPushButton::clicked, this, &MainWindow::selectTracePath);
+    connect(ui->lineTracePath, &QLineEdit::editingFinished, this, &MainWindow::setTraceSaveOn);
+    connect(ui->checkTraceBreakpoint, &QCheckBox::toggled, this, &MainWindow::setTraceSaveOn);
+    connect(ui->checkTraceTrap, &QCheckBox::toggled, this, &MainWindow::setTraceSaveOn);
+    connect(ui->buttonCoverageStart, &QPushButton::clicked, this, &MainWindow::coverageStartPressed);
+    connect(ui->buttonCoverageStop, &QPushButton::clicked, this, &MainWindow::coverageStopPressed);
+    connect(ui->buttonCoverageClear, &QPushButton::clicked, this, &MainWindow::coverageClearPressed);
+    connect(ui->buttonCoverageExport, &QPushButton::clicked, this, &MainWindow::exportCoverage);
+    connect(ui->buttonIoTraceStart, &QPushButton::clicked, this, &MainWindow::ioTraceStartPressed);
+    connect(ui->buttonIoTraceStop, &QPushButton::clicked, this, &MainWindow::ioTraceStopPressed);
+    connect(ui->buttonIoTraceExport, &QPushButton::clicked, this, &MainWindow::exportIoTrace);
+    connect(ui->buttonTimelineStart, &QPushButton::clicked, this, &MainWindow::timelineStartPressed);
+    connect(ui->buttonTimelineStop, &QPushButton::clicked, this, &MainWindow::timelineStopPressed);
+    connect(ui->buttonTimelineExport, &QPushButton::clicked, this, &MainWindow::exportTimeline);
     connect(ui->checkCharging, &QCheckBox::toggled, this, &MainWindow::changeBatteryCharging);
+
+    // Port trace filters, one row per range with everything traced to start with
+    ui->ioTraceFilterView->setColumnCount(3);
+    ui->ioTraceFilterView->setRowCount(IOTRACE_RANGES);
+    ui->ioTraceFilterView->setHorizontalHeaderLabels({ tr("Range"), tr("Reads"), tr("Writes") });
+    for (int i = 0; i < IOTRACE_RANGES; i++) {
+        ui->ioTraceFilterView->setItem(i, 0, new QTableWidgetItem(QStringLiteral("%1xxx %2").arg(i, 0, 16).arg(QString::fromLatin1(perf_range_names[i]))));
+        for (int column = 1; column <= 2; column++) {
+            QTableWidgetItem *item = new QTableWidgetItem();
+            item->setFlags(Qt::ItemIsUserCheckable | Qt::ItemIsEnabled);
+            item->setCheckState(Qt::Checked);
+            ui->ioTraceFilterView->setItem(i, column, item);
+        }
+    }
+    ui->ioTraceFilterView->resizeColumnsToContents();
+    connect(ui->ioTraceFilterView, &QTableWidget::itemChanged, this, &MainWindow::setIoTraceFilter);
     connect(ui->sliderBattery, &QSlider::valueChanged, this, &MainWindow::changeBatteryStatus);
-    connect(ui->disassemblyView->verticalScrollBar(), &QScrollBar::valueChanged, this, &MainWindow::scrollDisasmView);
 
     // Debugger Options
     connect(ui->buttonAddEquateFile, &QPushButton::clicked, this, &MainWindow::addEquateFileDialog);
@@ -130,6 +175,8 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(ui->actionScreenshot, &QAction::triggered, this, &MainWindow::screenshot);
     connect(ui->actionRecordGIF, &QAction::triggered, this, &MainWindow::recordGIF);
     connect(ui->actionTakeGIFScreenshot, &QAction::triggered, this, &MainWindow::screenshotGIF);
+    connect(ui->actionStreamFrames, &QAction::triggered, this, &MainWindow::streamFrames);
+    connect(ui->actionShareMemory, &QAction::triggered, this, &MainWindow::shareMemory);
     connect(ui->actionRestoreState, &QAction::triggered, this, &MainWindow::restoreEmuState);
     connect(ui->actionSaveState, &QAction::triggered, this, &MainWindow::saveEmuState);
     connect(ui->actionExportCalculatorState, &QAction::triggered, this, &MainWindow::saveToFile);
@@ -138,6 +185,7 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(ui->actionReloadROM, &QAction::triggered, this, &MainWindow::reloadROM);
     connect(ui->actionResetCalculator, &QAction::triggered, this, &MainWindow::resetCalculator);
     connect(ui->actionPopoutLCD, &QAction::triggered, this, &MainWindow::createLCD);
+    connect(ui->actionMemoryScanner, &QAction::triggered, this, &MainWindow::openMemoryScanner);
     connect(this, &MainWindow::resetTriggered, &emu, &EmuThread::resetTriggered);
 
     // Capture
@@ -145,6 +193,7 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(ui->buttonGIF, &QPushButton::clicked, this, &MainWindow::recordGIF);
     connect(ui->buttonGIFScreenshot, &QPushButton::clicked, this, &MainWindow::screenshotGIF);
     connect(ui->frameskipSlider, &QSlider::valueChanged, this, &MainWindow::changeFrameskip);
+    connect(ui->checkGifKeepFrames, &QCheckBox::toggled, this, &MainWindow::setGifKeepFrames);
 
     // About
     connect(ui->actionCheckForUpdates, &QAction::triggered, this, [=](){ this->checkForUpdates(true); });
@@ -156,6 +205,7 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     connect(ui->scaleSlider, &QSlider::sliderMoved, this, &MainWindow::reprintScale);
     connect(ui->scaleSlider, &QSlider::valueChanged, this, &MainWindow::changeScale);
     connect(ui->checkSkin, &QCheckBox::stateChanged, this, &MainWindow::toggleSkin);
+    connect(ui->checkSmooth, &QCheckBox::stateChanged, this, &MainWindow::toggleSmoothScaling);
     connect(ui->refreshSlider, &QSlider::valueChanged, this, &MainWindow::changeLCDRefresh);
     connect(ui->checkAlwaysOnTop, &QCheckBox::stateChanged, this, &MainWindow::alwaysOnTop);
     connect(ui->emulationSpeed, &QSlider::valueChanged, this, &MainWindow::changeEmulatedSpeed);
@@ -221,6 +271,18 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     setCorner(Qt::BottomLeftCorner, Qt::LeftDockWidgetArea);
     setCorner(Qt::BottomRightCorner, Qt::RightDockWidgetArea);
     setUIMode(true);
+
+    // Performance counters, hidden until asked for; created before the window state is restored
+    perfWidget = new PerfWidget(this);
+    perfDock = new QDockWidget(tr("Performance"), this);
+    perfDock->setObjectName(QStringLiteral("Performance"));
+    perfDock->setWidget(perfWidget);
+    addDockWidget(Qt::RightDockWidgetArea, perfDock);
+    perfDock->hide();
+    perfDock->toggleViewAction()->setText(tr("Performance counters"));
+    QList<QAction*> helpActions = ui->menuHelp->actions();
+    int scannerIndex = helpActions.indexOf(ui->actionMemoryScanner);
+    ui->menuHelp->insertAction(helpActions.value(scannerIndex + 1), perfDock->toggleViewAction());
     setAcceptDrops(true);
     debuggerOn = false;
 
@@ -233,8 +295,10 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
     changeThrottleMode(Qt::Checked);
     emu.rom = settings->value(QStringLiteral("romImage")).toString().toStdString();
     changeFrameskip(settings->value(QStringLiteral("frameskip"), 3).toUInt());
+    setGifKeepFrames(settings->value(QStringLiteral("gifKeepFrames"), false).toBool());
     changeScale(settings->value(QStringLiteral("scale"), 100).toUInt());
     toggleSkin(settings->value(QStringLiteral("skin"), 1).toBool());
+    toggleSmoothScaling(settings->value(QStringLiteral("smoothScaling"), false).toBool());
     changeLCDRefresh(settings->value(QStringLiteral("refreshRate"), 60).toUInt());
     changeEmulatedSpeed(settings->value(QStringLiteral("emuRate"), 10).toUInt());
     setFont(settings->value(QStringLiteral("textSize"), 9).toUInt());
@@ -310,6 +374,21 @@ MainWindow::MainWindow(QWidget *p) : QMainWindow(p), ui(new Ui::MainWindow) {
 
 MainWindow::~MainWindow() {
     debugger_free();
+    analysis_free();
+    profiler_free();
+    trace_free();
+    if (!coverageReportPath.isEmpty() && !writeCoverage(coverageReportPath, coverageListings)) {
+        fputs("failed to write the coverage report\n", stderr);
+    }
+    coverage_free();
+    iotrace_free();
+    timeline_free();
+
+    // The emulation thread has stopped by now, and the name would otherwise stay around after we exit
+    shm_export_stop();
+
+    // Joins the encoder thread if we're closed while recording; it can't be left to static destructors
+    gif_stop_recording();
 
     settings->setValue(QStringLiteral("windowState"), saveState(WindowStateVersion));
     settings->setValue(QStringLiteral("windowGeometry"), saveGeometry());
@@ -652,7 +731,8 @@ void MainWindow::recordGIF() {
       // TODO: Use QTemporaryFile?
       path = QDir::tempPath() + QDir::separator() + QStringLiteral("cemu_tmp.gif");
 
-        gif_start_recording(path.toStdString().c_str(), ui->frameskipSlider->value());
+        gif_start_recording(path.toStdString().c_str(), ui->frameskipSlider->value(),
+                            ui->checkGifKeepFrames->isChecked() ? GIF_WAIT_FOR_ENCODER : GIF_DROP_FRAMES);
     } else {
         if (gif_stop_recording()) {
             saveScreenshot(tr("GIF images (*.gif)"), QStringLiteral("gif"), path);
@@ -663,10 +743,59 @@ void MainWindow::recordGIF() {
     }
 
     ui->frameskipSlider->setEnabled(path.isEmpty());
+    ui->checkGifKeepFrames->setEnabled(path.isEmpty());
     ui->actionRecordGIF->setChecked(!path.isEmpty());
     ui->buttonGIF->setText((!path.isEmpty()) ? QString("Stop Recording") : QString("Record GIF"));
 }
 
+void MainWindow::streamFrames() {
+    if (!ui->actionStreamFrames->isChecked()) {
+        emu.stopStream();
+        return;
+    }
+
+    QFileDialog dialog(this);
+
+    // No overwrite prompt, so a named pipe can be picked as the target
+    dialog.setAcceptMode(QFileDialog::AcceptSave);
+    dialog.setFileMode(QFileDialog::AnyFile);
+    dialog.setOption(QFileDialog::DontConfirmOverwrite);
+    dialog.setDirectory(currentDir);
+    dialog.setNameFilters(QStringList() << tr("Y4M video (*.y4m)") << tr("Raw RGB565 frames (*.raw)") << tr("All files (*)"));
+    dialog.setWindowTitle(tr("Stream Frames"));
+
+    if (!dialog.exec() || dialog.selectedFiles().isEmpty()) {
+        ui->actionStreamFrames->setChecked(false);
+        return;
+    }
+    currentDir = dialog.directory();
+
+    QString path = dialog.selectedFiles().at(0);
+    emu.startStream(path, path.endsWith(QStringLiteral(".y4m"), Qt::CaseInsensitive) ? LCD_STREAM_Y4M : LCD_STREAM_RGB565);
+}
+
+void MainWindow::streamTo(const QString &path, lcd_stream_format_t format) {
+    ui->actionStreamFrames->setChecked(true);
+    emu.startStream(path, format);
+}
+
+void MainWindow::shareMemory() {
+    if (!ui->actionShareMemory->isChecked()) {
+        emu.stopShare();
+        return;
+    }
+
+    bool ok;
+    QString name = QInputDialog::getText(this, tr("Share Screen and RAM"), tr("Shared memory name:"), QLineEdit::Normal,
+                                         settings->value(QStringLiteral("shareName"), QStringLiteral("cemu")).toString(), &ok);
+    if (!ok || name.isEmpty()) {
+        ui->actionShareMemory->setChecked(false);
+        return;
+    }
+    settings->setValue(QStringLiteral("shareName"), name);
+    emu.startShare(name);
+}
+
 void MainWindow::changeFrameskip(int value) {
     settings->setValue(QStringLiteral("frameskip"), value);
     ui->frameskipLabel->setText(QString::number(value));
@@ -674,6 +803,11 @@ void MainWindow::changeFrameskip(int value) {
     changeFramerate();
 }
 
+void MainWindow::setGifKeepFrames(bool b) {
+    ui->checkGifKeepFrames->setChecked(b);
+    settings->setValue(QStringLiteral("gifKeepFrames"), b);
+}
+
 void MainWindow::changeFramerate() {
     float framerate = ((float) ui->refreshSlider->value()) / (ui->frameskipSlider->value() + 1);
     ui->framerateLabel->setText(QString::number(framerate).left(4));
@@ -822,6 +956,12 @@ void MainWindow::toggleSkin(bool enable) {
     adjustScreen();
 }
 
+void MainWindow::toggleSmoothScaling(bool enable) {
+    settings->setValue(QStringLiteral("smoothScaling"), enable);
+    ui->checkSmooth->setChecked(enable);
+    ui->lcdWidget->setSmoothScaling(enable);
+}
+
 void MainWindow::changeLCDRefresh(int value) {
     settings->setValue(QStringLiteral("refreshRate"), value);
     ui->refreshLabel->setText(QString::number(value)+" FPS");
@@ -830,6 +970,49 @@ void MainWindow::changeLCDRefresh(int value) {
     changeFramerate();
 }
 
+void MainWindow::lcdFrameReady() {
+    emu.lcdFrameHandled();
+    ui->lcdWidget->newFrame();
+}
+
+void MainWindow::waitForScreen(const lcd_wait_t &wait, const QString &screenshotPath) {
+    waitScreenshotPath = screenshotPath;
+    changeThrottleMode(Qt::Unchecked);
+    connect(&emu, &EmuThread::screenWaitDone, this, &MainWindow::screenWaitDone, Qt::QueuedConnection);
+    emu.startScreenWait(wait);
+}
+
+void MainWindow::screenWaitDone(int result, quint64 hash, QImage frame) {
+    QString outcome;
+    int code;
+
+    switch (result) {
+        case LCD_WAIT_MET:
+            outcome = QStringLiteral("met");
+            code = 0;
+            break;
+        case LCD_WAIT_TIMEOUT:
+            outcome = QStringLiteral("timeout");
+            code = 1;
+            break;
+        default:
+            outcome = QStringLiteral("cancelled");
+            code = 3;
+            break;
+    }
+    fputs(QStringLiteral("%1 %2\n").arg(outcome).arg(hash, 16, 16, QLatin1Char('0')).toStdString().c_str(), stdout);
+    fflush(stdout);
+
+    if (!waitScreenshotPath.isEmpty() && !frame.save(waitScreenshotPath, "PNG", 0)) {
+        fputs("failed to save screenshot\n", stderr);
+        if (!code) {
+            code = 1;
+        }
+    }
+    emu.stop();
+    qApp->exit(code);
+}
+
 void MainWindow::changeEmulatedSpeed(int value) {
     int actualSpeed = value*10;
     settings->setValue(QStringLiteral("emuRate"), value);
@@ -1120,6 +1303,12 @@ void MainWindow::raiseDebugger() {
     }
     ui->tabWidget->setCurrentWidget(ui->tabDebugger);
 
+    // Find the code in the ROM while the emulation is stopped; a ROM seen before is loaded straight back
+    QString analysisDir = QStandardPaths::writableLocation(QStandardPaths::GenericDataLocation) + QStringLiteral("/CEmu/analysis");
+    QDir().mkpath(analysisDir);
+    analysis_start(analysisDir.toStdString().c_str());
+    analysis_update();
+
     populateDebugWindow();
     setDebuggerState(true);
     connect(stepInShortcut, &QShortcut::activated, this, &MainWindow::stepInPressed);
@@ -1128,6 +1317,12 @@ void MainWindow::raiseDebugger() {
     connect(stepOutShortcut, &QShortcut::activated, this, &MainWindow::stepOutPressed);
 }
 
+void MainWindow::analysisDone() {
+    if (analysis_update() && debuggerOn) {
+        updateDisasmView(ui->disassemblyView->getSelectedAddress().toInt(nullptr, 16), true);
+    }
+}
+
 void MainWindow::leaveDebugger() {
     setDebuggerState(false);
 }
@@ -1424,6 +1619,10 @@ void MainWindow::populateDebugWindow() {
 
     updateTIOSView();
     updateStackView();
+    showTraceState();
+    showCoverageState();
+    showIoTraceState();
+    showTimelineState();
     ramUpdate();
     flashUpdate();
     memUpdate(cpu.registers.PC);
@@ -1480,29 +1679,287 @@ void MainWindow::updateTIOSView() {
 void MainWindow::updateDisasmView(const int sentBase, const bool newPane) {
     addressPane = sentBase;
     fromPane = newPane;
-    disasmOffsetSet = false;
-    disasm.adl = ui->checkADL->isChecked();
-    disasm.base_address = -1;
-    disasm.new_address = addressPane - ((newPane) ? 0x40 : 0);
-    if (disasm.new_address < 0) disasm.new_address = 0;
-    int32_t last_address = disasm.new_address + 0x120;
-    if (last_address > 0xFFFFFF) last_address = 0xFFFFFF;
+    ui->disassemblyView->setMode(ui->checkADL->isChecked(), ui->checkDataCol->isChecked(), ui->checkCyclesCol->isChecked());
+    ui->disassemblyView->setAddress(static_cast<uint32_t>(addressPane), fromPane);
+}
+
+void MainWindow::showSelectionCycles(int instructions, quint64 cycles, quint64 taken) {
+    QString msg = tr("Selected %1 instructions, %2 cycles").arg(instructions).arg(cycles);
+    if (taken != cycles) {
+        msg += tr(" (%1 with every branch taken)").arg(taken);
+    }
+    showStatusMsg(msg);
+}
+
+// The profiler is only started, stopped and exported from the debugger, while the emulation is stopped
+void MainWindow::profileExactPressed() {
+    profiler_start(PROFILER_EXACT, 0);
+    showProfilerState();
+}
+
+void MainWindow::profileSamplePressed() {
+    profiler_start(PROFILER_SAMPLE, static_cast<uint32_t>(ui->spinProfileInterval->value()));
+    showProfilerState();
+}
+
+void MainWindow::profileStopPressed() {
+    profiler_stop();
+    showProfilerState();
+}
+
+void MainWindow::showProfilerState() {
+    switch (profiler.mode) {
+        case PROFILER_EXACT:
+            ui->labelProfiler->setText(tr("Profiling every instruction while running."));
+            break;
+        case PROFILER_SAMPLE:
+            ui->labelProfiler->setText(tr("Sampling every %1 cycles while running.").arg(profiler.interval));
+            break;
+        default:
+            ui->labelProfiler->setText(tr("Not profiling."));
+            break;
+    }
+    ui->buttonProfileStop->setEnabled(profiler.mode != PROFILER_OFF);
+}
+
+void MainWindow::exportProfile() {
+    QString path = QFileDialog::getSaveFileName(this, tr("Export profile"),
+                                                currentDir.absoluteFilePath(QStringLiteral("callgrind.out")),
+                                                tr("Callgrind files (callgrind.out*);;All files (*.*)"));
+    if (path.isEmpty()) {
+        return;
+    }
+    currentDir = QFileInfo(path).absoluteDir();
+    if (!profiler_export(path.toStdString().c_str())) {
+        QMessageBox::warning(this, tr("Could not export"), tr("The profile couldn't be written."));
+    }
+}
+
+// Like the profiler, the trace is only touched while the emulation is stopped
+void MainWindow::traceStartPressed() {
+    if (!trace_start(static_cast<uint32_t>(ui->spinTraceSize->value()) << 20, ui->checkTraceWrites->isChecked())) {
+        QMessageBox::warning(this, tr("Could not record"), tr("There isn't enough memory for a trace this large."));
+    }
+    showTraceState();
+}
+
+void MainWindow::traceStopPressed() {
+    trace_stop();
+    showTraceState();
+}
+
+void MainWindow::showTraceState() {
+    quint64 instructions = trace_instructions();
+    if (trace.active) {
+        ui->labelTrace->setText(tr("Recording while running; %1 instructions so far.").arg(instructions));
+    } else if (instructions) {
+        ui->labelTrace->setText(tr("Not recording; %1 instructions were recorded.").arg(instructions));
+    } else {
+        ui->labelTrace->setText(tr("Not recording."));
+    }
+    ui->buttonTraceStop->setEnabled(trace.active);
+    ui->buttonTraceSave->setEnabled(instructions != 0);
+}
+
+void MainWindow::saveTrace() {
+    QString path = QFileDialog::getSaveFileName(this, tr("Save trace"),
+                                                currentDir.absoluteFilePath(QStringLiteral("cemu.trc")),
+                                                tr("Trace files (*.trc);;All files (*.*)"));
+    if (path.isEmpty()) {
+        return;
+    }
+    currentDir = QFileInfo(path).absoluteDir();
+    if (!trace_save(path.toStdString().c_str())) {
+        QMessageBox::warning(this, tr("Could not save"), tr("The trace couldn't be written."));
+    }
+}
+
+void MainWindow::selectTracePath() {
+    QString path = QFileDialog::getSaveFileName(this, tr("Save the trace automatically to"),
+                                                currentDir.absoluteFilePath(QStringLiteral("cemu.trc")),
+                                                tr("Trace files (*.trc);;All files (*.*)"));
+    if (!path.isEmpty()) {
+        ui->lineTracePath->setText(path);
+        setTraceSaveOn();
+    }
+}
+
+void MainWindow::setTraceSaveOn() {
+    unsigned int events = 0;
+    if (ui->checkTraceBreakpoint->isChecked()) {
+        events |= TRACE_SAVE_BREAKPOINT;
+    }
+    if (ui->checkTraceTrap->isChecked()) {
+        events |= TRACE_SAVE_TRAP;
+    }
+    if (ui->lineTracePath->text().isEmpty()) {
+        events = 0;
+    }
+    trace_save_on(ui->lineTracePath->text().toStdString().c_str(), events);
+}
+
+void MainWindow::recordCoverage(const QString &path, const QStringList &listings) {
+    coverageReportPath = path;
+    coverageListings = listings;
+    if (!coverage_start()) {
+        fputs("not enough memory for coverage\n", stderr);
+    }
+}
+
+bool MainWindow::writeCoverage(const QString &path, const QStringList &listings) {
+    std::vector<std::string> names;
+    std::vector<const char*> paths;
+    for (const QString &listing : listings) {
+        names.push_back(listing.toStdString());
+    }
+    for (const std::string &name : names) {
+        paths.push_back(name.c_str());
+    }
+    return coverage_export_lcov(path.toStdString().c_str(), paths.data(), static_cast<unsigned int>(paths.size()));
+}
+
+void MainWindow::coverageStartPressed() {
+    if (!coverage_start()) {
+        QMessageBox::warning(this, tr("Could not record"), tr("There isn't enough memory for coverage."));
+    }
+    showCoverageState();
+}
+
+void MainWindow::coverageStopPressed() {
+    coverage_stop();
+    showCoverageState();
+}
+
+void MainWindow::coverageClearPressed() {
+    coverage_clear();
+    showCoverageState();
+}
+
+void MainWindow::showCoverageState() {
+    quint32 instructions = coverage_instructions();
+    if (coverage.active) {
+        ui->labelCoverage->setText(tr("Recording while running; %1 different instructions have run.").arg(instructions));
+    } else {
+        ui->labelCoverage->setText(tr("Not recording; %1 different instructions have run.").arg(instructions));
+    }
+    ui->buttonCoverageStop->setEnabled(coverage.active);
+}
+
+void MainWindow::exportCoverage() {
+    QStringList listings = QFileDialog::getOpenFileNames(this, tr("Listings of the code to report on"),
+                                                         currentDir.absolutePath(),
+                                                         tr("spasm listings (*.lst);;All files (*.*)"));
+    if (listings.isEmpty()) {
+        return;
+    }
+    QString path = QFileDialog::getSaveFileName(this, tr("Export coverage"),
+                                                currentDir.absoluteFilePath(QStringLiteral("coverage.info")),
+                                                tr("lcov tracefiles (*.info);;All files (*.*)"));
+    if (path.isEmpty()) {
+        return;
+    }
+    currentDir = QFileInfo(path).absoluteDir();
+    if (!writeCoverage(path, listings)) {
+        QMessageBox::warning(this, tr("Could not export"), tr("A listing couldn't be read or the report couldn't be written."));
+    }
+}
 
-    ui->disassemblyView->verticalScrollBar()->blockSignals(true);
-    ui->disassemblyView->clear();
-    ui->disassemblyView->clearAllHighlights();
-    ui->disassemblyView->cursorState(false);
-    ui->disassemblyView->verticalScrollBar()->blockSignals(false);
-    while (disasm.new_address < last_address) {
-        drawNextDisassembleLine();
+// The ranges checked in a column of the filter table: 1 for reads, 2 for writes
+uint16_t MainWindow::ioTraceRanges(int column) {
+    uint16_t ranges = 0;
+    for (int i = 0; i < IOTRACE_RANGES; i++) {
+        if (ui->ioTraceFilterView->item(i, column)->checkState() == Qt::Checked) {
+            ranges |= 1 << i;
+        }
     }
+    return ranges;
+}
 
-    ui->disassemblyView->cursorState(true);
+void MainWindow::setIoTraceFilter() {
+    if (iotrace.recording) {
+        iotrace_filter(ioTraceRanges(1), ioTraceRanges(2));
+        showIoTraceState();
+    }
+}
+
+void MainWindow::ioTraceStartPressed() {
+    if (!iotrace_start(static_cast<uint32_t>(ui->spinIoTraceSize->value()) << 10, ioTraceRanges(1), ioTraceRanges(2))) {
+        QMessageBox::warning(this, tr("Could not record"), tr("There isn't enough memory for a trace this large."));
+    }
+    showIoTraceState();
+}
 
-    ui->disassemblyView->updateAllHighlights();
+void MainWindow::ioTraceStopPressed() {
+    iotrace_stop();
+    showIoTraceState();
+}
 
-    ui->disassemblyView->setTextCursor(disasmOffset);
-    ui->disassemblyView->centerCursor();
+void MainWindow::showIoTraceState() {
+    bool active = iotrace.recording;
+    quint32 count = iotrace_count();
+    quint64 total = iotrace_total();
+    if (!active && !total) {
+        ui->labelIoTrace->setText(tr("Not recording."));
+    } else {
+        ui->labelIoTrace->setText((active ? tr("Recording while running; %1 accesses held of %2 so far.")
+                                          : tr("Not recording; %1 accesses held of %2.")).arg(count).arg(total));
+    }
+    ui->buttonIoTraceStop->setEnabled(active);
+    ui->buttonIoTraceExport->setEnabled(count != 0);
+}
+
+void MainWindow::exportIoTrace() {
+    QString csv = tr("CSV files (*.csv)");
+    QString filter;
+    QString path = QFileDialog::getSaveFileName(this, tr("Export port trace"),
+                                                currentDir.absoluteFilePath(QStringLiteral("ports.csv")),
+                                                csv + tr(";;Binary port traces (*.iot)"), &filter);
+    if (path.isEmpty()) {
+        return;
+    }
+    currentDir = QFileInfo(path).absoluteDir();
+    std::string name = path.toStdString();
+    if (!(filter == csv ? iotrace_export_csv(name.c_str()) : iotrace_export_binary(name.c_str()))) {
+        QMessageBox::warning(this, tr("Could not export"), tr("The port trace couldn't be written."));
+    }
+}
+
+void MainWindow::timelineStartPressed() {
+    if (!timeline_start(static_cast<uint32_t>(ui->spinTimelineSize->value()) << 10)) {
+        QMessageBox::warning(this, tr("Could not record"), tr("There isn't enough memory for a timeline this large."));
+    }
+    showTimelineState();
+}
+
+void MainWindow::timelineStopPressed() {
+    timeline_stop();
+    showTimelineState();
+}
+
+void MainWindow::showTimelineState() {
+    quint32 count = timeline_count();
+    if (timeline.active) {
+        ui->labelTimeline->setText(tr("Recording while running; %1 records held.").arg(count));
+    } else if (count) {
+        ui->labelTimeline->setText(tr("Not recording; %1 records held.").arg(count));
+    } else {
+        ui->labelTimeline->setText(tr("Not recording."));
+    }
+    ui->buttonTimelineStop->setEnabled(timeline.active);
+    ui->buttonTimelineExport->setEnabled(count != 0);
+}
+
+void MainWindow::exportTimeline() {
+    QString path = QFileDialog::getSaveFileName(this, tr("Export timeline"),
+                                                currentDir.absoluteFilePath(QStringLiteral("timeline.json")),
+                                                tr("Chrome trace files (*.json)"));
+    if (path.isEmpty()) {
+        return;
+    }
+    currentDir = QFileInfo(path).absoluteDir();
+    if (!timeline_export(path.toStdString().c_str())) {
+        QMessageBox::warning(this, tr("Could not export"), tr("The timeline couldn't be written."));
+    }
 }
 
 void MainWindow::addPort() {
@@ -1872,76 +2329,11 @@ void MainWindow::updateStackView() {
     ui->stackView->moveCursor(QTextCursor::Start);
 }
 
-void MainWindow::drawNextDisassembleLine() {
-    std::string *label = 0;
-    if (disasm.base_address != disasm.new_address) {
-        disasm.base_address = disasm.new_address;
-        addressMap_t::iterator item = disasm.addressMap.find(disasm.new_address);
-        if (item != disasm.addressMap.end()) {
-            disasmHighlight.hit_read_breakpoint = false;
-            disasmHighlight.hit_write_breakpoint = false;
-            disasmHighlight.hit_exec_breakpoint = false;
-            disasmHighlight.hit_run_breakpoint = false;
-            disasmHighlight.hit_pc = false;
-
-            disasm.instruction.data.clear();
-            disasm.instruction.opcode.clear();
-            disasm.instruction.mode_suffix.clear();
-            disasm.instruction.arguments.clear();
-            disasm.instruction.size = 0;
-
-            label = &item->second;
-        } else {
-            disassembleInstruction();
-        }
-    } else {
-        disassembleInstruction();
-    }
-
-    // Some round symbol things
-    QString breakpointSymbols = QString("<font color='#A3FFA3'><big>%1</font><font color='#A3A3FF'>%2</font><font color='#FFA3A3'>%3</big></font>")
-                                   .arg(((disasmHighlight.hit_read_breakpoint == true)  ? "&#9679;" : " "),
-                                        ((disasmHighlight.hit_write_breakpoint == true) ? "&#9679;" : " "),
-                                        ((disasmHighlight.hit_exec_breakpoint == true)  ? "&#9679;" : " "));
-
-    // Simple syntax highlighting
-    QString instructionArgsHighlighted = QString::fromStdString(disasm.instruction.arguments)
-                                        .replace(QRegularExpression("(\\$[0-9a-fA-F]+)"), "<font color='green'>\\1</font>") // hex numbers
-                                        .replace(QRegularExpression("(^\\d)"), "<font color='blue'>\\1</font>")             // dec number
-                                        .replace(QRegularExpression("([()])"), "<font color='#600'>\\1</font>");            // parentheses
-
-    QString formattedLine = QString("<pre><b><font color='#444'>%1</font></b> %2 %3  <font color='darkblue'>%4%5</font>%6</pre>")
-                               .arg(int2hex(disasm.base_address, 6),
-                                    breakpointSymbols,
-                                    label ? QString::fromStdString(*label) + ":" : ui->checkDataCol->isChecked() ? QString::fromStdString(disasm.instruction.data).leftJustified(12, ' ') : "",
-                                    QString::fromStdString(disasm.instruction.opcode),
-                                    QString::fromStdString(disasm.instruction.mode_suffix),
-                                    instructionArgsHighlighted);
-
-    ui->disassemblyView->blockSignals(true);
-    ui->disassemblyView->appendHtml(formattedLine);
-
-    if (!disasmOffsetSet && disasm.new_address > addressPane) {
-        disasmOffsetSet = true;
-        disasmOffset = ui->disassemblyView->textCursor();
-        disasmOffset.movePosition(QTextCursor::StartOfLine);
-    }
-
-    if (disasmHighlight.hit_run_breakpoint == true) {
-        ui->disassemblyView->addHighlight(QColor(Qt::blue).lighter(160));
-    }
-    if (disasmHighlight.hit_pc == true) {
-        ui->disassemblyView->addHighlight(QColor(Qt::red).lighter(160));
-    }
-    ui->disassemblyView->blockSignals(false);
-}
-
 void MainWindow::disasmContextMenu(const QPoint& posa) {
     QString set_pc = "Set PC to this address";
     QString run_until = "Toggle Run Until this address";
     QString toggle_break = "Toggle Breakpoint at this address";
     QString goto_mem = "Goto Memory View";
-    ui->disassemblyView->setTextCursor(ui->disassemblyView->cursorForPosition(posa));
     QPoint globalPos = ui->disassemblyView->mapToGlobal(posa);
 
     QMenu contextMenu;
@@ -2007,7 +2399,6 @@ void MainWindow::stepInPressed() {
     }
 
     disconnect(stepInShortcut, &QShortcut::activated, this, &MainWindow::stepInPressed);
-    ui->disassemblyView->verticalScrollBar()->blockSignals(true);
 
     debuggerOn = false;
     updateDebuggerChanges();
@@ -2019,12 +2410,25 @@ void MainWindow::createLCD() {
     p->show();
 }
 
+void MainWindow::logPerformance(const QString &path) {
+    perfWidget->startLog(path);
+}
+
+void MainWindow::openMemoryScanner() {
+    if (!memScanner) {
+        memScanner = new MemScanWidget(this);
+        connect(memScanner, &MemScanWidget::gotoAddress, this, &MainWindow::memGoto);
+    }
+    memScanner->show();
+    memScanner->raise();
+    memScanner->activateWindow();
+}
+
 void MainWindow::stepOverPressed() {
     if(!inDebugger) {
         return;
     }
 
-    ui->disassemblyView->verticalScrollBar()->blockSignals(true);
     disconnect(stepOverShortcut, &QShortcut::activated, this, &MainWindow::stepOverPressed);
 
     debuggerOn = false;
@@ -2037,7 +2441,6 @@ void MainWindow::stepNextPressed() {
         return;
     }
 
-    ui->disassemblyView->verticalScrollBar()->blockSignals(true);
     disconnect(stepNextShortcut, &QShortcut::activated, this, &MainWindow::stepNextPressed);
 
     debuggerOn = false;
@@ -2050,7 +2453,6 @@ void MainWindow::stepOutPressed() {
         return;
     }
 
-    ui->disassemblyView->verticalScrollBar()->blockSignals(true);
     disconnect(stepOutShortcut, &QShortcut::activated, this, &MainWindow::stepOutPressed);
 
     debuggerOn = false;
@@ -2111,54 +2513,35 @@ void MainWindow::changeBatteryStatus(int value) {
 void MainWindow::flashUpdate() {
     ui->flashEdit->setFocus();
     int line = ui->flashEdit->getLine();
-    ui->flashEdit->setData(QByteArray::fromRawData((char*)mem.flash.block, 0x400000));
+    ui->flashEdit->setData(flashDevice);
     ui->flashEdit->setLine(line);
 }
 
 void MainWindow::ramUpdate() {
     ui->ramEdit->setFocus();
     int line = ui->ramEdit->getLine();
-    ui->ramEdit->setData(QByteArray::fromRawData((char*)mem.ram.block, 0x65800));
+    ui->ramEdit->setData(ramDevice);
     ui->ramEdit->setAddressOffset(0xD00000);
     ui->ramEdit->setLine(line);
 }
 
 void MainWindow::memUpdate(uint32_t addressBegin) {
     ui->memEdit->setFocus();
-    QByteArray mem_data;
-
-    bool locked = ui->checkLockPosition->isChecked();
-    int32_t start, line = 0;
-
-    if (locked) {
-        start = static_cast<int32_t>(ui->memEdit->addressOffset());
-        line = ui->memEdit->getLine();
-    } else {
-        start = static_cast<int32_t>(addressBegin) - 0x1000;
-    }
-
-    if (start < 0) { start = 0; }
-    int32_t end = start+0x2000;
-    if (end > 0xFFFFFF) { end = 0xFFFFFF; }
+    int line = ui->memEdit->getLine();
+    ui->memEdit->setData(memDevice);
 
-    memSize = end-start;
-
-    for (int32_t i=start; i<end; i++) {
-        mem_data.append(debug_read_byte(i));
-    }
-
-    ui->memEdit->setData(mem_data);
-    ui->memEdit->setAddressOffset(start);
-
-    if (locked) {
+    if (ui->checkLockPosition->isChecked()) {
         ui->memEdit->setLine(line);
     } else {
-        ui->memEdit->setCursorPosition((addressBegin-start)<<1);
+        ui->memEdit->setCursorPosition((addressBegin & 0xFFFFFF)<<1);
         ui->memEdit->ensureVisible();
     }
 }
 
-void MainWindow::searchEdit(QHexEdit *editor) {
+// Matches past this many are counted but not kept
+static const uint32_t maxSearchHits = 0x10000;
+
+void MainWindow::searchEdit(QHexEdit *editor, mem_search_area_t area, uint32_t base) {
     SearchWidget search;
     search.setSearchString(searchingString);
     search.setInputMode(hexSearch);
@@ -2173,36 +2556,53 @@ void MainWindow::searchEdit(QHexEdit *editor) {
         return;
     }
 
-    QString searchString;
-    if(hexSearch == true) {
-        searchString = searchingString;
-    } else {
-        searchString = QString::fromStdString(searchingString.toLatin1().toHex().toStdString());
-    }
-
     editor->setFocus();
-    std::string s = searchString.toUpper().toStdString();
-    if(searchString.isEmpty()) {
+    if(searchingString.isEmpty()) {
         return;
     }
-    if((searchString.length() & 1) || s.find_first_not_of("0123456789ABCDEF") != std::string::npos) {
+
+    // Hex input may hold several patterns split by '|', which are all searched for in the same pass
+    std::vector<mem_pattern_t> patterns;
+    bool ok = true;
+    if(hexSearch == true) {
+        QStringList parts = searchingString.split(QLatin1Char('|'));
+        ok = parts.size() <= MEM_SEARCH_MAX_PATTERNS;
+        patterns.resize(parts.size());
+        for (int i = 0; ok && i < parts.size(); i++) {
+            ok = mem_pattern_parse(&patterns[i], parts[i].toLatin1().constData());
+        }
+    } else {
+        QByteArray bytes = searchingString.toLatin1();
+        patterns.resize(1);
+        ok = mem_pattern_bytes(&patterns[0], reinterpret_cast<const uint8_t*>(bytes.constData()), bytes.size());
+    }
+    if(!ok) {
         QMessageBox::warning(this,"Error", "Error when reading input string");
         return;
     }
 
-    QByteArray string_int;
-    for (int i=0; i<searchString.length(); i+=2) {
-        QString a = searchString.at(i);
-        a.append(searchString.at(i+1));
-        string_int.append(hex2int(a));
-    }
-    if(editor->indexOf(string_int, editor->cursorPosition()) == -1) {
+    std::vector<mem_search_hit_t> hits(maxSearchHits);
+    uint32_t found = mem_search(patterns.data(), patterns.size(), area, hits.data(), hits.size());
+    if(!found) {
         QMessageBox::warning(this,"Not Found","Hex string not found.");
+        return;
+    }
+    hits.resize(std::min<uint32_t>(found, hits.size()));
+
+    // Go to the first match at or after the cursor, wrapping around to the first one
+    uint32_t cursor = base + editor->cursorPosition()/2;
+    auto hit = std::lower_bound(hits.begin(), hits.end(), cursor, [](const mem_search_hit_t &h, uint32_t a) { return h.address < a; });
+    if(hit == hits.end()) {
+        hit = hits.begin();
     }
+    editor->selectRange(hit->address - base, patterns[hit->pattern].length);
+
+    QString count = found > hits.size() ? tr("more than %1").arg(hits.size()) : QString::number(found);
+    showStatusMsg(tr("Match %1 of %2 at %3").arg(hit - hits.begin() + 1).arg(count).arg(int2hex(hit->address, 6)));
 }
 
 void MainWindow::flashSearchPressed() {
-    searchEdit(ui->flashEdit);
+    searchEdit(ui->flashEdit, MEM_SEARCH_FLASH, 0);
 }
 
 void MainWindow::flashGotoPressed() {
@@ -2223,7 +2623,7 @@ void MainWindow::flashGotoPressed() {
 }
 
 void MainWindow::ramSearchPressed() {
-    searchEdit(ui->ramEdit);
+    searchEdit(ui->ramEdit, MEM_SEARCH_RAM, 0xD00000);
 }
 
 void MainWindow::ramGotoPressed() {
@@ -2243,7 +2643,7 @@ void MainWindow::ramGotoPressed() {
     ui->ramEdit->ensureVisible();
 }
 void MainWindow::memSearchPressed() {
-    searchEdit(ui->memEdit);
+    searchEdit(ui->memEdit, MEM_SEARCH_MAPPED, 0);
 }
 
 void MainWindow::memGoto(QString address) {
@@ -2253,21 +2653,9 @@ void MainWindow::memGoto(QString address) {
         return;
     }
 
-    QByteArray mem_data;
-    int start = int_address-0x500;
-    if (start < 0) { start = 0; }
-    int end = start+0x1000;
-    if (end > 0xFFFFFF) { end = 0xFFFFFF; }
-
-    memSize = end-start;
-
-    for (int i=start; i<end; i++) {
-        mem_data.append(debug_read_byte(i));
-    }
-
-    ui->memEdit->setData(mem_data);
-    ui->memEdit->setAddressOffset(start);
-    ui->memEdit->setCursorPosition((int_address-start)<<1);
+    // Reload so the page shows memory as it is now; as before, edits that weren't synced are dropped
+    ui->memEdit->setData(memDevice);
+    ui->memEdit->setCursorPosition(int_address<<1);
     ui->memEdit->ensureVisible();
 }
 
@@ -2282,6 +2670,9 @@ void MainWindow::memGotoPressed() {
 }
 
 void MainWindow::syncHexView(int posa, QHexEdit *hex_view) {
+    if (inDebugger) {
+        lcd_frame_redraw();
+    }
     populateDebugWindow();
     updateDisasmView(addressPane, fromPane);
     hex_view->setFocus();
@@ -2290,51 +2681,45 @@ void MainWindow::syncHexView(int posa, QHexEdit *hex_view) {
 
 void MainWindow::flashSyncPressed() {
     qint64 posa = ui->flashEdit->cursorPosition();
-    memcpy(mem.flash.block, reinterpret_cast<uint8_t*>(ui->flashEdit->data().data()), 0x400000);
+    ui->flashEdit->writeChanged(flashDevice);
     syncHexView(posa, ui->flashEdit);
 }
 
 void MainWindow::ramSyncPressed() {
     qint64 posa = ui->ramEdit->cursorPosition();
-    memcpy(mem.ram.block, reinterpret_cast<uint8_t*>(ui->ramEdit->data().data()), 0x65800);
+    ui->ramEdit->writeChanged(ramDevice);
     syncHexView(posa, ui->ramEdit);
 }
 
 void MainWindow::memSyncPressed() {
-    int start = ui->memEdit->addressOffset();
     qint64 posa = ui->memEdit->cursorPosition();
-
-    for (int i = 0; i<memSize; i++) {
-        debug_write_byte(i+start, ui->memEdit->dataAt(i, 1).at(0));
-    }
-
+    ui->memEdit->writeChanged(memDevice);
     syncHexView(posa, ui->memEdit);
 }
 
 void MainWindow::clearEquateFile() {
-    // Reset the map
-    currentEquateFile.clear();
-    disasm.addressMap.clear();
+    currentEquateFiles.clear();
+    symbols_clear();
     QMessageBox::warning(this, tr("Equates Cleared"), tr("Cleared disassembly equates."));
     updateDisasmView(ui->disassemblyView->getSelectedAddress().toInt(nullptr,16), true);
 }
 
 void MainWindow::refreshEquateFile() {
-    // Reset the map
-    if(fileExists(currentEquateFile.toStdString())) {
-        disasm.addressMap.clear();
-        addEquateFile(currentEquateFile);
-        updateDisasmView(ui->disassemblyView->getSelectedAddress().toInt(nullptr,16), true);
-    } else {
-        QMessageBox::warning(this, tr("Error Opening"), tr("Couldn't open equates file."));
+    // Reload every file, so the ones that changed on disk are picked up
+    QStringList files = currentEquateFiles;
+    currentEquateFiles.clear();
+    symbols_clear();
+    for (const QString &file : files) {
+        addEquateFile(file);
     }
+    updateDisasmView(ui->disassemblyView->getSelectedAddress().toInt(nullptr,16), true);
 }
 
 void MainWindow::addEquateFileDialog() {
     QFileDialog dialog(this);
     int good;
     dialog.setAcceptMode(QFileDialog::AcceptOpen);
-    dialog.setFileMode(QFileDialog::ExistingFile);
+    dialog.setFileMode(QFileDialog::ExistingFiles);
     dialog.setDirectory(currentDir);
 
     QStringList extFilters;
@@ -2347,44 +2732,19 @@ void MainWindow::addEquateFileDialog() {
 
     if (!good) { return; }
 
-    std::string current;
-    std::ifstream in;
-    addEquateFile(dialog.selectedFiles().first());
+    for (const QString &file : dialog.selectedFiles()) {
+        addEquateFile(file);
+    }
+    updateDisasmView(ui->disassemblyView->getSelectedAddress().toInt(nullptr,16), true);
 }
 
 void MainWindow::addEquateFile(QString fileName) {
-    std::string current;
-    std::ifstream in;
-    currentEquateFile = fileName;
-    in.open(fileName.toStdString());
-
-    if (in.good()) {
-        QRegularExpression equatesRegexp("^\\h*([^\\W\\d]\\w*)\\h*(?:=|\\h\\.?equ(?!\\d))\\h*(?|\\$([\\da-f]{4,})|(\\d[\\da-f]{3,})h)\\h*(?:;.*)?$",
-                                         QRegularExpression::CaseInsensitiveOption);
-        // Reset the map
-        disasm.addressMap.clear();
-        while (std::getline(in, current)) {
-            QRegularExpressionMatch matches = equatesRegexp.match(QString::fromStdString(current));
-            if (matches.hasMatch()) {
-                uint32_t address = static_cast<uint32_t>(matches.capturedRef(2).toUInt(nullptr, 16));
-                std::string &item = disasm.addressMap[address];
-                if (item.empty()) {
-                    item = matches.captured(1).toStdString();
-                    uint8_t *ptr = phys_mem_ptr(address - 4, 9);
-                    if (ptr && ptr[4] == 0xC3 && (ptr[0] == 0xC3 || ptr[8] == 0xC3)) { // jump table?
-                        uint32_t address2  = ptr[5] | ptr[6] << 8 | ptr[7] << 16;
-                        if (phys_mem_ptr(address2, 1)) {
-                            std::string &item2 = disasm.addressMap[address2];
-                            if (item2.empty()) {
-                                item2 = "_" + item;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        in.close();
-        updateDisasmView(ui->disassemblyView->getSelectedAddress().toInt(nullptr,16), true);
+    // Loading a file again would only add every symbol in it twice; Refresh is how to pick up changes
+    if (currentEquateFiles.contains(fileName)) {
+        return;
+    }
+    if (symbols_load(fileName.toStdString().c_str())) {
+        currentEquateFiles.append(fileName);
     } else {
         QMessageBox messageBox;
         messageBox.critical(0, tr("Error"), tr("Couldn't open this file"));
@@ -2392,19 +2752,6 @@ void MainWindow::addEquateFile(QString fileName) {
     }
 }
 
-void MainWindow::scrollDisasmView(int value) {
-    if (value >= ui->disassemblyView->verticalScrollBar()->value()) {
-        if (value >= ui->disassemblyView->verticalScrollBar()->maximum()) {
-            ui->disassemblyView->verticalScrollBar()->blockSignals(true);
-            disconnect(ui->disassemblyView->verticalScrollBar(), &QScrollBar::valueChanged, this, &MainWindow::scrollDisasmView);
-            drawNextDisassembleLine();
-            ui->disassemblyView->verticalScrollBar()->setValue(ui->disassemblyView->verticalScrollBar()->maximum()-1);
-            connect(ui->disassemblyView->verticalScrollBar(), &QScrollBar::valueChanged, this, &MainWindow::scrollDisasmView);
-            ui->disassemblyView->verticalScrollBar()->blockSignals(false);
-        }
-    }
-}
-
 void MainWindow::resetCalculator() {
     if (inReceivingMode) {
         refreshVariableList();
@@ -12,11 +12,24 @@
 #include "lcdwidget.h"
 #include "romselection.h"
 #include "emuthread.h"
+#include "memorydevice.h"
+#include "disasmwidget.h"
 #include "../../core/vat.h"
+#include "../../core/memsearch.h"
 #include "../../core/debug/debug.h"
 #include "../../core/debug/disasm.h"
+#include "../../core/debug/symbols.h"
+#include "../../core/debug/analysis.h"
+#include "../../core/debug/profiler.h"
+#include "../../core/debug/trace.h"
+#include "../../core/debug/coverage.h"
+#include "../../core/debug/iotrace.h"
+#include "../../core/debug/timeline.h"
 #include "qhexedit/qhexedit.h"
 
+class MemScanWidget;
+class PerfWidget;
+
 namespace Ui {
     class MainWindow;
 }
@@ -29,6 +42,15 @@ public:
     explicit MainWindow(QWidget *p = 0);
     ~MainWindow();
 
+    // Run at full speed until the screen matches, then quit with 0 or 1 for a timeout
+    void waitForScreen(const lcd_wait_t &wait, const QString &screenshotPath);
+    // Append the performance counters to path as JSON every second
+    void logPerformance(const QString &path);
+    // Gather coverage from now on, and write it as an lcov report mapped through listings on exit
+    void recordCoverage(const QString &path, const QStringList &listings);
+    // Stream every frame to path once the emulation runs
+    void streamTo(const QString &path, lcd_stream_format_t format);
+
 public slots:
     // Misc.
     void closeEvent(QCloseEvent*) override;
@@ -89,7 +111,10 @@ private:
     void screenshotGIF(void);
     void saveScreenshot(QString,QString,QString);
     void recordGIF(void);
+    void streamFrames(void);
+    void shareMemory(void);
     void changeFrameskip(int);
+    void setGifKeepFrames(bool);
     void changeFramerate(void);
     void checkForUpdates(bool);
     void showAbout(void);
@@ -104,6 +129,7 @@ private:
     void debugCommand();
     void raiseDebugger();
     void leaveDebugger();
+    void analysisDone();
     void updateDebuggerChanges();
     void populateDebugWindow();
     void setDebuggerState(bool);
@@ -118,7 +144,6 @@ private:
     void setPreviousBreakpointAddress(QTableWidgetItem*);
     void setPreviousPortValues(QTableWidgetItem*);
     void deleteBreakpoint();
-    void drawNextDisassembleLine();
     void stepInPressed();
     void stepOverPressed();
     void stepNextPressed();
@@ -126,16 +151,44 @@ private:
     void updateTIOSView();
     void updateStackView();
     void updateDisasmView(const int, const bool);
+    void showSelectionCycles(int, quint64, quint64);
+    void profileExactPressed();
+    void profileSamplePressed();
+    void profileStopPressed();
+    void showProfilerState();
+    void exportProfile();
+    void traceStartPressed();
+    void traceStopPressed();
+    void showTraceState();
+    void saveTrace();
+    void selectTracePath();
+    void setTraceSaveOn();
+    void coverageStartPressed();
+    void coverageStopPressed();
+    void coverageClearPressed();
+    void showCoverageState();
+    void exportCoverage();
+    bool writeCoverage(const QString &path, const QStringList &listings);
+    void ioTraceStartPressed();
+    void ioTraceStopPressed();
+    void setIoTraceFilter();
+    uint16_t ioTraceRanges(int column);
+    void showIoTraceState();
+    void exportIoTrace();
+    void timelineStartPressed();
+    void timelineStopPressed();
+    void showTimelineState();
+    void exportTimeline();
     void gotoPressed();
     void setBreakpointAddress();
     void disasmContextMenu(const QPoint &);
     void vatContextMenu(const QPoint &);
     void opContextMenu(const QPoint &);
-    void scrollDisasmView(int);
     bool addBreakpoint();
 
     // Others
     void createLCD();
+    void openMemoryScanner();
     void screenContextMenu(const QPoint &);
     void addEquateFileDialog();
     void addEquateFile(QString);
@@ -155,7 +208,10 @@ private:
     void adjustScreen();
     void changeScale(int);
     void toggleSkin(bool);
+    void toggleSmoothScaling(bool);
     void changeLCDRefresh(int);
+    void lcdFrameReady();
+    void screenWaitDone(int, quint64, QImage);
     void alwaysOnTop(int);
     void autoCheckForUpdates(int);
     int reprintScale(int);
@@ -183,7 +239,7 @@ private:
     void memSearchPressed();
     void memSyncPressed();
     void syncHexView(int, QHexEdit *);
-    void searchEdit(QHexEdit *);
+    void searchEdit(QHexEdit *, mem_search_area_t, uint32_t);
 
     // Keypad
     void keymapChanged();
@@ -210,14 +266,22 @@ private:
     QLabel statusLabel;
     QSettings *settings = nullptr;
     QDockWidget *debuggerDock = nullptr;
-    QTextCursor disasmOffset;
-    bool disasmOffsetSet;
+    MemScanWidget *memScanner = nullptr;
+    QDockWidget *perfDock = nullptr;
+    PerfWidget *perfWidget = nullptr;
     bool fromPane;
     int addressPane;
-    int memSize;
+
+    // Flash, RAM and the whole address space, as the hex views see them
+    MemoryDevice flashDevice{0, 0x400000};
+    MemoryDevice ramDevice{0xD00000, 0x65800};
+    MemoryDevice memDevice{0, 0x1000000};
 
     QDir currentDir;
-    QString currentEquateFile;
+    QStringList currentEquateFiles;
+    QString waitScreenshotPath;
+    QString coverageReportPath;
+    QStringList coverageListings;
     EmuThread emu;
 
     bool debuggerOn = false;
@@ -0,0 +1,50 @@
+#include "memorydevice.h"
+
+#include <cstring>
+
+#include "../../core/debug/debug.h"
+
+MemoryDevice::MemoryDevice(uint32_t start, uint32_t bytes, QObject *p) : QIODevice(p), base(start), length(bytes) {}
+
+// Reading ahead could touch ports nobody asked for
+bool MemoryDevice::open(OpenMode mode) {
+    return QIODevice::open(mode | QIODevice::Unbuffered);
+}
+
+bool MemoryDevice::isSequential() const {
+    return false;
+}
+
+qint64 MemoryDevice::size() const {
+    return length;
+}
+
+qint64 MemoryDevice::readData(char *data, qint64 maxSize) {
+    qint64 count = qMin(maxSize, length - pos());
+    if (count <= 0) {
+        return count < 0 ? -1 : 0;
+    }
+
+    uint32_t address = base + static_cast<uint32_t>(pos());
+    uint32_t end = address + static_cast<uint32_t>(count);
+
+    // Ports are left alone unless the emulation is stopped in the debugger
+    if (!inDebugger && end > 0xE00000) {
+        uint32_t mmio = qMax(address, 0xE00000u);
+        debug_read_block(address, mmio - address, reinterpret_cast<uint8_t*>(data));
+        memset(data + (mmio - address), 0, end - mmio);
+    } else {
+        debug_read_block(address, static_cast<uint32_t>(count), reinterpret_cast<uint8_t*>(data));
+    }
+    return count;
+}
+
+qint64 MemoryDevice::writeData(const char *data, qint64 maxSize) {
+    qint64 count = qMin(maxSize, length - pos());
+    if (count <= 0) {
+        return count < 0 ? -1 : 0;
+    }
+
+    debug_write_block(base + static_cast<uint32_t>(pos()), static_cast<uint32_t>(count), reinterpret_cast<const uint8_t*>(data));
+    return count;
+}
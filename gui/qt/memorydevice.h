@@ -0,0 +1,25 @@
+#ifndef MEMORYDEVICE_H
+#define MEMORYDEVICE_H
+
+#include <QtCore/QIODevice>
+
+// Emulated memory read and written through the debugger as it is accessed, so a QHexEdit only pages in what it shows
+class MemoryDevice : public QIODevice {
+    Q_OBJECT
+
+public:
+    explicit MemoryDevice(uint32_t base, uint32_t length, QObject *p = Q_NULLPTR);
+
+    bool open(OpenMode mode) override;
+    bool isSequential() const override;
+    qint64 size() const override;
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override;
+    qint64 writeData(const char *data, qint64 maxSize) override;
+
+private:
+    uint32_t base, length;
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "memscanwidget.h"
+#include "ui_memscanwidget.h"
+
+#include <QtWidgets/QMessageBox>
+
+#include <algorithm>
+#include <vector>
+
+#include "../../core/mem.h"
+
+// Only this many candidates are listed; the count covers all of them
+static const uint32_t maxScanRows = 1000;
+
+MemScanWidget::MemScanWidget(QWidget *p) : QDialog(p), ui(new Ui::memscanwidget) {
+    ui->setupUi(this);
+
+    connect(ui->buttonNew, &QPushButton::clicked, this, &MemScanWidget::newScan);
+    connect(ui->buttonEqual, &QPushButton::clicked, this, &MemScanWidget::narrowEqual);
+    connect(ui->buttonChanged, &QPushButton::clicked, this, &MemScanWidget::narrowChanged);
+    connect(ui->buttonUnchanged, &QPushButton::clicked, this, &MemScanWidget::narrowUnchanged);
+    connect(ui->buttonIncreased, &QPushButton::clicked, this, &MemScanWidget::narrowIncreased);
+    connect(ui->buttonDecreased, &QPushButton::clicked, this, &MemScanWidget::narrowDecreased);
+    connect(ui->tableResults, &QTableWidget::cellDoubleClicked, this, &MemScanWidget::resultActivated);
+
+    showResults();
+}
+
+MemScanWidget::~MemScanWidget() {
+    mem_scan_end();
+    delete ui;
+}
+
+void MemScanWidget::newScan() {
+    type = static_cast<mem_scan_type_t>(ui->comboType->currentIndex());
+    if (!mem_scan_start(static_cast<mem_scan_area_t>(ui->comboArea->currentIndex()), type)) {
+        QMessageBox::warning(this, tr("Error"), tr("Could not start a scan."));
+    }
+    showResults();
+}
+
+void MemScanWidget::narrowEqual() {
+    narrow(MEM_SCAN_EQUAL);
+}
+
+void MemScanWidget::narrowChanged() {
+    narrow(MEM_SCAN_CHANGED);
+}
+
+void MemScanWidget::narrowUnchanged() {
+    narrow(MEM_SCAN_UNCHANGED);
+}
+
+void MemScanWidget::narrowIncreased() {
+    narrow(MEM_SCAN_INCREASED);
+}
+
+void MemScanWidget::narrowDecreased() {
+    narrow(MEM_SCAN_DECREASED);
+}
+
+void MemScanWidget::narrow(mem_scan_op_t op) {
+    uint8_t value[MEM_SCAN_FLOAT_SIZE] = {0};
+
+    if (!mem_scan_active()) {
+        newScan();
+    }
+    if (op == MEM_SCAN_EQUAL && !parseValue(value)) {
+        QMessageBox::warning(this, tr("Error"), tr("Error when reading the value"));
+        return;
+    }
+    mem_scan_narrow(op, value);
+    showResults();
+}
+
+// Integers may be decimal or hex with a $ or 0x in front; reals are read as written
+bool MemScanWidget::parseValue(uint8_t *value) {
+    QString text = ui->lineValue->text().trimmed();
+    bool ok;
+
+    if (type == MEM_SCAN_FLOAT) {
+        double real = text.toDouble(&ok);
+        return ok && mem_scan_float_encode(real, value);
+    }
+
+    uint32_t width = mem_scan_width(type);
+    uint32_t number = text.startsWith(QLatin1Char('$')) ? text.mid(1).toUInt(&ok, 16) : text.toUInt(&ok, 0);
+    if (!ok || (width < 4 && number >> (width * 8))) {
+        return false;
+    }
+    for (uint32_t i = 0; i < width; i++) {
+        value[i] = static_cast<uint8_t>(number >> (i * 8));
+    }
+    return true;
+}
+
+QString MemScanWidget::valueAt(uint32_t address) {
+    uint32_t width = mem_scan_width(type);
+    const uint8_t *ptr = phys_mem_ptr(address, width);
+    double real;
+
+    if (!ptr) {
+        return QString();
+    }
+    if (type == MEM_SCAN_FLOAT) {
+        return mem_scan_float_decode(ptr, &real) ? QString::number(real, 'g', 14) : QString();
+    }
+
+    uint32_t number = 0;
+    for (uint32_t i = width; i--;) {
+        number = number << 8 | ptr[i];
+    }
+    return QString::number(number) + QStringLiteral(" ($") + QString::number(number, 16).rightJustified(width * 2, '0').toUpper() + QStringLiteral(")");
+}
+
+void MemScanWidget::showResults() {
+    uint32_t count = mem_scan_count();
+    std::vector<uint32_t> addresses(std::min(count, maxScanRows));
+
+    addresses.resize(mem_scan_results(addresses.data(), addresses.size()));
+
+    ui->tableResults->setRowCount(0);
+    ui->tableResults->setRowCount(static_cast<int>(addresses.size()));
+    for (size_t i = 0; i < addresses.size(); i++) {
+        QString address = QString::number(addresses[i], 16).rightJustified(6, '0').toUpper();
+        ui->tableResults->setItem(static_cast<int>(i), 0, new QTableWidgetItem(address));
+        ui->tableResults->setItem(static_cast<int>(i), 1, new QTableWidgetItem(valueAt(addresses[i])));
+    }
+
+    if (!mem_scan_active()) {
+        ui->labelCount->setText(tr("No scan running"));
+    } else if (count > addresses.size()) {
+        ui->labelCount->setText(tr("%1 candidates, showing the first %2").arg(count).arg(addresses.size()));
+    } else {
+        ui->labelCount->setText(tr("%1 candidates").arg(count));
+    }
+}
+
+void MemScanWidget::resultActivated(int row) {
+    QTableWidgetItem *item = ui->tableResults->item(row, 0);
+    if (item) {
+        emit gotoAddress(item->text());
+    }
+}
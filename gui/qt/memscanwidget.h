@@ -0,0 +1,39 @@
+#ifndef MEMSCANWIDGET_H
+#define MEMSCANWIDGET_H
+
+#include <QtWidgets/QDialog>
+
+#include "../../core/memscan.h"
+
+namespace Ui { class memscanwidget; }
+
+class MemScanWidget : public QDialog {
+    Q_OBJECT
+
+public:
+    explicit MemScanWidget(QWidget *p = 0);
+    ~MemScanWidget();
+
+signals:
+    void gotoAddress(QString address);
+
+private slots:
+    void newScan();
+    void narrowEqual();
+    void narrowChanged();
+    void narrowUnchanged();
+    void narrowIncreased();
+    void narrowDecreased();
+    void resultActivated(int row);
+
+private:
+    void narrow(mem_scan_op_t op);
+    bool parseValue(uint8_t *value);
+    QString valueAt(uint32_t address);
+    void showResults();
+
+    Ui::memscanwidget *ui;
+    mem_scan_type_t type = MEM_SCAN_8;
+};
+
+#endif
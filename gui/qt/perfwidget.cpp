@@ -0,0 +1,156 @@
+#include "perfwidget.h"
+
+#include <QtWidgets/QVBoxLayout>
+#include <QtWidgets/QHBoxLayout>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QFileDialog>
+#include <QtWidgets/QMessageBox>
+
+#include "../../core/schedule.h"
+
+static const int refreshInterval = 1000;
+
+PerfWidget::PerfWidget(QWidget *p) : QWidget(p) {
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    QHBoxLayout *buttons = new QHBoxLayout();
+    QTreeWidgetItem *group;
+    int i;
+
+    tree = new QTreeWidget(this);
+    tree->setColumnCount(2);
+    tree->setHeaderLabels({ tr("Counter"), tr("Rate") });
+    tree->setRootIsDecorated(true);
+    tree->setUniformRowHeights(true);
+    tree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+    tree->header()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
+
+    group = addGroup(tr("Emulation"));
+    speed = addRow(group, tr("Speed"));
+    clock = addRow(group, tr("Cycles"));
+    mips = addRow(group, tr("Instructions"));
+    cpi = addRow(group, tr("Cycles per instruction"));
+    interrupts = addRow(group, tr("Interrupts"));
+    flashAccesses = addRow(group, tr("Flash accesses"));
+    flashShare = addRow(group, tr("Cycles waiting on flash"));
+
+    group = addGroup(tr("Scheduler events"));
+    for (i = 0; i < SCHED_NUM_ITEMS; i++) {
+        events[i] = addRow(group, QString::fromLatin1(perf_event_names[i]));
+    }
+
+    group = addGroup(tr("MMIO reads / writes"));
+    for (i = 0; i < PERF_RANGES; i++) {
+        mmio[i] = addRow(group, QStringLiteral("%1 (%2)").arg(i, 0, 16).arg(QString::fromLatin1(perf_range_names[i])));
+    }
+
+    group = addGroup(tr("Host time"));
+    for (i = 0; i < PERF_HOST_COUNT; i++) {
+        host[i] = addRow(group, QString::fromLatin1(perf_host_names[i]));
+    }
+
+    group = addGroup(tr("Frames"));
+    fps = addRow(group, tr("Frames"));
+    frameP50 = addRow(group, tr("Median frame time"));
+    frameP90 = addRow(group, tr("90th percentile"));
+    frameP99 = addRow(group, tr("99th percentile"));
+    frameMax = addRow(group, tr("Longest"));
+
+    buttonLog = new QPushButton(tr("Log to JSON..."), this);
+    buttons->addStretch();
+    buttons->addWidget(buttonLog);
+    layout->addWidget(tree);
+    layout->addLayout(buttons);
+
+    connect(buttonLog, &QPushButton::clicked, this, &PerfWidget::toggleLog);
+    connect(&refreshTimer, &QTimer::timeout, this, &PerfWidget::refresh);
+    refreshTimer.start(refreshInterval);
+}
+
+QTreeWidgetItem *PerfWidget::addGroup(const QString &name) {
+    QTreeWidgetItem *group = new QTreeWidgetItem(tree, { name });
+    group->setExpanded(true);
+    return group;
+}
+
+QTreeWidgetItem *PerfWidget::addRow(QTreeWidgetItem *group, const QString &name) {
+    QTreeWidgetItem *row = new QTreeWidgetItem(group, { name, QStringLiteral("-") });
+    row->setTextAlignment(1, Qt::AlignRight);
+    return row;
+}
+
+void PerfWidget::startLog(const QString &path) {
+    logPath = path;
+    buttonLog->setText(tr("Stop logging"));
+}
+
+void PerfWidget::stopLog() {
+    logPath.clear();
+    buttonLog->setText(tr("Log to JSON..."));
+}
+
+void PerfWidget::toggleLog() {
+    if (!logPath.isEmpty()) {
+        stopLog();
+        return;
+    }
+    QString path = QFileDialog::getSaveFileName(this, tr("Log performance counters to"), QString(),
+                                                tr("JSON lines (*.jsonl *.json);;All files (*.*)"));
+    if (!path.isEmpty()) {
+        startLog(path);
+    }
+}
+
+// The counters keep going while nobody looks, so this also runs while the dock is hidden to keep the log going
+void PerfWidget::refresh() {
+    perf_snapshot_t s;
+    double seconds, cycles;
+    int i;
+
+    if (!logPath.isEmpty() && !perf_dump_json(logPath.toStdString().c_str())) {
+        stopLog();
+        QMessageBox::warning(this, tr("Could not log"), tr("The performance counters couldn't be written."));
+    }
+    if (!isVisible()) {
+        haveLast = false;
+        return;
+    }
+
+    perf_snapshot(&s);
+    // Counting starts over whenever the emulation does
+    if (!haveLast || s.time_ns <= last.time_ns || s.instructions < last.instructions || s.frames < last.frames) {
+        last = s;
+        haveLast = true;
+        return;
+    }
+
+    seconds = (s.time_ns - last.time_ns) / 1e9;
+    cycles = s.cycles - last.cycles;
+    speed->setText(1, QStringLiteral("%1%").arg(cycles / (sched.clockRates[CLOCK_CPU] * seconds) * 100, 0, 'f', 1));
+    clock->setText(1, tr("%1 MHz").arg(cycles / seconds / 1e6, 0, 'f', 2));
+    mips->setText(1, tr("%1 M/s").arg((s.instructions - last.instructions) / seconds / 1e6, 0, 'f', 2));
+    cpi->setText(1, s.instructions != last.instructions
+                 ? QString::number(cycles / (s.instructions - last.instructions), 'f', 2) : QStringLiteral("-"));
+    interrupts->setText(1, tr("%1/s").arg((s.interrupts - last.interrupts) / seconds, 0, 'f', 0));
+    flashAccesses->setText(1, tr("%1/s").arg((s.flash_accesses - last.flash_accesses) / seconds, 0, 'f', 0));
+    flashShare->setText(1, cycles ? QStringLiteral("%1%").arg((s.flash_cycles - last.flash_cycles) / cycles * 100, 0, 'f', 1)
+                                  : QStringLiteral("-"));
+
+    for (i = 0; i < SCHED_NUM_ITEMS; i++) {
+        events[i]->setText(1, tr("%1/s").arg((s.events[i] - last.events[i]) / seconds, 0, 'f', 0));
+    }
+    for (i = 0; i < PERF_RANGES; i++) {
+        mmio[i]->setText(1, tr("%1 / %2 /s").arg((s.mmio_reads[i] - last.mmio_reads[i]) / seconds, 0, 'f', 0)
+                                          .arg((s.mmio_writes[i] - last.mmio_writes[i]) / seconds, 0, 'f', 0));
+    }
+    for (i = 0; i < PERF_HOST_COUNT; i++) {
+        host[i]->setText(1, QStringLiteral("%1%").arg((s.host_ns[i] - last.host_ns[i]) / (seconds * 1e7), 0, 'f', 1));
+    }
+
+    fps->setText(1, tr("%1/s").arg((s.frames - last.frames) / seconds, 0, 'f', 1));
+    frameP50->setText(1, tr("%1 ms").arg(s.frame_p50_ns / 1e6, 0, 'f', 2));
+    frameP90->setText(1, tr("%1 ms").arg(s.frame_p90_ns / 1e6, 0, 'f', 2));
+    frameP99->setText(1, tr("%1 ms").arg(s.frame_p99_ns / 1e6, 0, 'f', 2));
+    frameMax->setText(1, tr("%1 ms").arg(s.frame_max_ns / 1e6, 0, 'f', 2));
+
+    last = s;
+}
@@ -0,0 +1,44 @@
+#ifndef PERFWIDGET_H
+#define PERFWIDGET_H
+
+#include <QtWidgets/QWidget>
+#include <QtWidgets/QTreeWidget>
+#include <QtWidgets/QPushButton>
+#include <QtCore/QTimer>
+
+#include "../../core/perf.h"
+
+// Live view of the core's performance counters, as rates over the last refresh
+class PerfWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit PerfWidget(QWidget *p = 0);
+
+    // Also append every refresh to path as a line of JSON
+    void startLog(const QString &path);
+    void stopLog();
+
+private slots:
+    void refresh();
+    void toggleLog();
+
+private:
+    QTreeWidgetItem *addGroup(const QString &name);
+    QTreeWidgetItem *addRow(QTreeWidgetItem *group, const QString &name);
+
+    QTreeWidget *tree;
+    QPushButton *buttonLog;
+    QTimer refreshTimer;
+    QString logPath;
+    perf_snapshot_t last;
+    bool haveLast = false;
+
+    QTreeWidgetItem *speed, *clock, *mips, *cpi, *interrupts, *flashAccesses, *flashShare;
+    QTreeWidgetItem *events[SCHED_NUM_ITEMS];
+    QTreeWidgetItem *mmio[PERF_RANGES];
+    QTreeWidgetItem *host[PERF_HOST_COUNT];
+    QTreeWidgetItem *fps, *frameP50, *frameP90, *frameP99, *frameMax;
+};
+
+#endif
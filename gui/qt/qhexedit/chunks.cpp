@@ -1,5 +1,6 @@
 #include "chunks.h"
 #include <limits.h>
+#include <string.h>
 
 #define NORMAL 0
 #define HIGHLIGHTED 1
@@ -144,6 +145,36 @@ bool Chunks::write(QIODevice &iODevice, qint64 posa, qint64 count) {
     return ok;
 }
 
+// Only the bytes that were edited, in place; assumes nothing was inserted or removed.
+// Written bytes stop counting as edited, so the next write doesn't put them back over newer data
+bool Chunks::writeChanged(QIODevice &iODevice) {
+    bool ok = iODevice.open(QIODevice::WriteOnly);
+
+    if (ok) {
+        for (int chunkIdx = 0; chunkIdx < _chunks.size(); chunkIdx++) {
+            Chunk &chunk = _chunks[chunkIdx];
+            int size = chunk.dataChanged.size();
+            for (int idx = 0; idx < size; ) {
+                if (!chunk.dataChanged.at(idx)) {
+                    idx++;
+                    continue;
+                }
+                int end = idx;
+                while (end < size && chunk.dataChanged.at(end)) {
+                    end++;
+                }
+                iODevice.seek(chunk.absPos + idx);
+                iODevice.write(chunk.data.constData() + idx, end - idx);
+                memset(chunk.dataChanged.data() + idx, 0, end - idx);
+                idx = end;
+            }
+        }
+        iODevice.close();
+    }
+
+    return ok;
+}
+
 
 /* Set and get highlighting infos */
 void Chunks::setDataChanged(qint64 posa, bool dataChanged_) {
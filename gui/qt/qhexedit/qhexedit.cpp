@@ -192,6 +192,10 @@ bool QHexEdit::write(QIODevice &iODevice, qint64 posa, qint64 count) {
     return _chunks->write(iODevice, posa, count);
 }
 
+bool QHexEdit::writeChanged(QIODevice &iODevice) {
+    return _chunks->writeChanged(iODevice);
+}
+
 /* Char handling */
 void QHexEdit::replace(qint64 index, char ch) {
     _undoStack->overwrite(index, ch);
@@ -229,11 +233,7 @@ void QHexEdit::setBytesPerLine(int bytes) {
 qint64 QHexEdit::indexOf(const QByteArray &ba, qint64 from) {
     qint64 posa = _chunks->indexOf(ba, from/2);
     if (posa > -1) {
-        qint64 curPos = posa*2;
-        setCursorPosition(curPos + ba.length()*2);
-        resetSelection(curPos);
-        setSelection(curPos + ba.length()*2);
-        ensureVisible();
+        selectRange(posa, ba.length());
     }
     return posa;
 }
@@ -256,6 +256,14 @@ qint64 QHexEdit::lastIndexOf(const QByteArray &ba, qint64 from) {
     return posa;
 }
 
+void QHexEdit::selectRange(qint64 pos, qint64 count) {
+    qint64 curPos = pos*2;
+    setCursorPosition(curPos + count*2);
+    resetSelection(curPos);
+    setSelection(curPos + count*2);
+    ensureVisible();
+}
+
 void QHexEdit::redo() {
     _undoStack->redo();
     setCursorPosition(_chunks->pos()*2);
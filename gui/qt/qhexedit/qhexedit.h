@@ -28,6 +28,7 @@ public:
     bool setData(QIODevice &iODevice);
     QByteArray dataAt(qint64 pos, qint64 count=-1);
     bool write(QIODevice &iODevice, qint64 pos=0, qint64 count=-1);
+    bool writeChanged(QIODevice &iODevice);
 
     // Char handling
     void insert(qint64 pos, char ch);
@@ -46,6 +47,7 @@ public:
     qint64 indexOf(const QByteArray &ba, qint64 from);
     bool isModified();
     qint64 lastIndexOf(const QByteArray &ba, qint64 from);
+    void selectRange(qint64 pos, qint64 count);
     QString selectionToReadableString();
     virtual void setFont(const QFont &font);
     QString toReadableString();
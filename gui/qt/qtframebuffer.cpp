@@ -20,19 +20,35 @@
 #include "../../core/lcd.h"
 #include "../../core/asic.h"
 
+static const lcd_frame_t *shownFrame = nullptr;
+
+const lcd_frame_t *acquireFrame() {
+    return shownFrame = lcd_frame_acquire();
+}
+
+const lcd_frame_t *currentFrame() {
+    return shownFrame ? shownFrame : acquireFrame();
+}
+
 QImage renderFramebuffer(lcd_state_t *lcds) {
-    lcd_drawframe(lcd_framebuffer, lcds);
-    return QImage(reinterpret_cast<const uchar*>(lcd_framebuffer), 320, 240, QImage::Format_RGBA8888);
+    if (lcds == &lcd) {
+        const lcd_frame_t *frame = currentFrame();
+        return QImage(reinterpret_cast<const uchar*>(frame->pixels), 320, 240, QImage::Format_RGBA8888).copy();
+    }
+    QImage image(320, 240, QImage::Format_RGBA8888);
+    lcd_drawframe(reinterpret_cast<uint32_t*>(image.bits()), lcds);
+    return image;
+}
+
+bool framebufferOn(lcd_state_t *lcds) {
+    return lcds && (lcd.control & 0x800) && !asic.ship_mode_enabled;
 }
 
 void paintFramebuffer(QPainter *p, lcd_state_t *lcds) {
-    if (lcds && (lcd.control & 0x800) && !asic.ship_mode_enabled) {
-        QImage img = renderFramebuffer(lcds);
-        p->drawImage(p->window(), img);
-        float factor = (310-(float)backlight.brightness)/160.0;
-        if (factor < 1) {
-            p->fillRect(p->window(), QColor(0, 0, 0, (1 - factor) * 255));
-        }
+    if (framebufferOn(lcds)) {
+        QImage image(320, 240, QImage::Format_RGBA8888);
+        lcd_drawframe_dimmed(reinterpret_cast<uint32_t*>(image.bits()), lcds, backlight.brightness);
+        p->drawImage(p->window(), image);
     } else {
         p->fillRect(p->window(), Qt::black);
         p->setPen(Qt::white);
@@ -10,7 +10,13 @@ public:
     virtual void paint(QPainter *p) override;
 };
 
+// The triple buffer has a single reader: only the main LCD view picks up new frames, and everything
+// else in the GUI uses the one it picked up last
+const lcd_frame_t *acquireFrame();
+const lcd_frame_t *currentFrame();
+
 QImage renderFramebuffer(lcd_state_t *lcds);
 void paintFramebuffer(QPainter *p, lcd_state_t *lcds);
+bool framebufferOn(lcd_state_t *lcds);
 
 #endif
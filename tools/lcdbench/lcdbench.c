@@ -0,0 +1,263 @@
+/*
+ * Times the conversion of whole LCD frames to RGBA8888 on one core, for every bpp mode and every pixel order
+ * the kernels treat differently (RGB or BGR, big endian bytes, big endian pixels within a byte), with every row
+ * kernel this host can run and with the per-pixel lcd_bgr16out() path the row kernels replaced. Each kernel's
+ * frames are checked against the old path first. The paletted modes have one kernel everywhere, shown under
+ * scalar.
+ *
+ * Usage: lcdbench [seconds]
+ *   seconds    how long to time each mode, order and kernel for, 0.2 by default
+ *
+ * lcd.c is built into the benchmark so its kernels can be called directly.
+ */
+
+#include "../../core/lcd.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../../core/os/os.h"
+
+/* The core calls back into whatever front end it runs under */
+void gui_do_stuff(void) {}
+void gui_entered_send_state(bool entered) { (void)entered; }
+void gui_console_printf(const char *format, ...) { (void)format; }
+void gui_console_err_printf(const char *format, ...) { (void)format; }
+void gui_debugger_raise_or_disable(bool entered) { (void)entered; }
+void gui_debugger_send_command(int reason, uint32_t address) { (void)reason; (void)address; }
+void gui_render_gif_frame(void) {}
+void gui_set_busy(bool busy) { (void)busy; }
+void gui_emu_sleep(void) {}
+void throttle_timer_wait(void) {}
+
+#define BENCH_RGB  (1 << 8)     /* Swap R and B, as the OS sets it */
+#define BENCH_BEBO (1 << 9)
+#define BENCH_BEPO (1 << 10)
+
+typedef struct {
+    const char *name;
+    lcd_row_kernel_t kernel;    /* NULL for the old per-pixel path */
+    bool (*supported)(void);
+} bench_kernel_t;
+
+static const char *const bench_modes[8] = {
+    "1bpp", "2bpp", "4bpp", "8bpp", "16bpp 1:5:5:5", "24bpp", "16bpp 5:6:5", "12bpp 4:4:4"
+};
+
+/* Whether an order bit changes anything in a mode, so runs that would only repeat another are left out */
+static bool bench_order_used(unsigned int mode, uint32_t order) {
+    if (order & BENCH_BEPO && mode >= 4) {
+        return false;
+    }
+    if (order & BENCH_BEBO && mode == 5) {
+        return false;
+    }
+    return true;
+}
+
+static void old_bgr16out(uint_fast32_t bgr16, bool rgb, uint32_t **out) {
+    uint_fast32_t r, g, b;
+
+    r = (rgb ? bgr16 >> 10 : bgr16 << 1) & 0x3E;
+    r |= r >> 5;
+    r = c6_to_c8(r);
+
+    g = bgr16 >> 5 & 0x3F;
+    g = c6_to_c8(g);
+
+    b = (rgb ? bgr16 << 1 : bgr16 >> 10) & 0x3E;
+    b |= b >> 5;
+    b = c6_to_c8(b);
+
+    *(*out)++ = r | (g << 8) | (b << 16) | (0xFFu << 24);
+}
+
+static uint_fast32_t old_nextword(uint32_t *ofs) {
+    uint_fast32_t word = 0;
+    *ofs &= lcd_dma_size - 1;
+    if (*ofs < ram_size) {
+        word = *(uint32_t *) (mem.ram.block + *ofs);
+    }
+    *ofs += 4;
+    return word;
+}
+
+/* lcd_drawframe() as it was before the row kernels */
+static void old_drawframe(uint32_t *out, lcd_state_t *lcd_state) {
+    uint_fast8_t mode = lcd_state->control >> 1 & 7;
+    bool rgb = lcd_state->control & (1 << 8);
+    bool bebo = lcd_state->control & (1 << 9);
+    uint_fast32_t words = 320 * 240;
+    uint_fast32_t word, color;
+    uint32_t ofs = lcd_state->upcurr & ~7;
+
+    if (mode < 4) {
+        uint_fast8_t bpp = 1 << mode;
+        uint_fast32_t mask = (1 << bpp) - 1;
+        uint_fast8_t bi = bebo ? 0 : 24;
+        bool bepo = lcd_state->control & (1 << 10);
+        if (!bepo) {
+            bi ^= (8 - bpp);
+        }
+        do {
+            uint_fast8_t bitpos = 32;
+            word = old_nextword(&ofs);
+            do {
+                color = lcd.palette[word >> ((bitpos -= bpp) ^ bi) & mask];
+                old_bgr16out(color + (color & 0xFFE0) + (color >> 10 & 0x20), rgb, &out);
+                words--;
+            } while (bitpos != 0);
+        } while (words != 0);
+    } else if (mode == 5) {
+        do {
+            word = old_nextword(&ofs);
+            old_bgr16out((word >> 8 & 0xF800) | (word >> 5 & 0x7E0) | (word >> 3 & 0x1F), rgb, &out);
+            words--;
+        } while (words != 0);
+    } else {
+        do {
+            uint_fast8_t i = 2;
+            word = old_nextword(&ofs);
+            if (bebo) {
+                word = word << 16 | word >> 16;
+            }
+            do {
+                color = word & 0xFFFF;
+                if (mode == 4) {
+                    color += (color & 0xFFE0) + (color >> 10 & 0x20);
+                } else if (mode == 7) {
+                    color = (color << 4 & 0xF000) | (color << 3 & 0x780) | (color << 1 & 0x1E);
+                }
+                old_bgr16out(color, rgb, &out);
+                word >>= 16;
+                words--;
+            } while (--i != 0);
+        } while (words != 0);
+    }
+}
+
+static bool bench_always(void) {
+    return true;
+}
+
+#ifdef LCD_SIMD_X86
+static bool bench_sse2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+}
+
+static bool bench_avx2(void) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+static const bench_kernel_t bench_kernels[] = {
+    { "old", NULL, bench_always },
+    { "scalar", lcd_row_scalar, bench_always },
+#if defined(LCD_SIMD_X86)
+    { "sse2", lcd_row_sse2, bench_sse2 },
+    { "avx2", lcd_row_avx2, bench_avx2 },
+#elif defined(LCD_SIMD_SSE2_ONLY)
+    { "sse2", lcd_row_sse2, bench_always },
+#elif defined(LCD_SIMD_NEON)
+    { "neon", lcd_row_neon, bench_always },
+#endif
+};
+
+static void bench_frame(const bench_kernel_t *kernel, uint32_t *out) {
+    if (kernel->kernel) {
+        lcd_row_kernel = kernel->kernel;
+        lcd_convert_rows(out, &lcd, 256, NULL);
+    } else {
+        old_drawframe(out, &lcd);
+    }
+}
+
+/* Frames per second converting for at least seconds */
+static double bench_time(const bench_kernel_t *kernel, uint32_t *out, double seconds) {
+    uint64_t start = os_time_ns(), elapsed;
+    uint64_t frames = 0, batch = 16, i;
+
+    do {
+        for (i = 0; i < batch; i++) {
+            bench_frame(kernel, out);
+        }
+        frames += batch;
+        elapsed = os_time_ns() - start;
+    } while (elapsed < seconds * 1e9);
+
+    return frames * 1e9 / elapsed;
+}
+
+int main(int argc, char **argv) {
+    static uint32_t expected[320 * 240], actual[320 * 240];
+    const unsigned int kernels = sizeof(bench_kernels) / sizeof(bench_kernels[0]);
+    double seconds = argc > 1 ? atof(argv[1]) : 0.2;
+    bool ok = true;
+    unsigned int mode, k;
+    uint32_t order;
+    uint32_t i;
+
+    if (argc > 2 || seconds <= 0) {
+        fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+        return 2;
+    }
+
+    /* Noise, so no kernel gets to skip work on runs of one color */
+    if (!(mem.ram.block = malloc(ram_size))) {
+        return 1;
+    }
+    srand(1);
+    for (i = 0; i < ram_size; i++) {
+        mem.ram.block[i] = (uint8_t)rand();
+    }
+    for (i = 0; i < 0x100; i++) {
+        lcd.palette[i] = (uint16_t)rand();
+    }
+    lcd.upcurr = 0xD40000;
+
+    printf("%-14s%-15s", "mode", "order");
+    for (k = 0; k < kernels; k++) {
+        if (bench_kernels[k].supported()) {
+            printf("%12s", bench_kernels[k].name);
+        }
+    }
+    printf("   frames/s on one core\n");
+
+    for (mode = 0; mode < 8; mode++) {
+        for (order = 0; order <= (BENCH_RGB | BENCH_BEBO | BENCH_BEPO); order += BENCH_RGB) {
+            char name[16];
+            if (!bench_order_used(mode, order)) {
+                continue;
+            }
+            lcd.control = mode << 1 | order;
+            old_drawframe(expected, &lcd);
+            snprintf(name, sizeof(name), "%s%s%s", order & BENCH_RGB ? "rgb" : "bgr",
+                     order & BENCH_BEBO ? " bebo" : "", order & BENCH_BEPO ? " bepo" : "");
+            printf("%-14s%-15s", bench_modes[mode], name);
+            for (k = 0; k < kernels; k++) {
+                const bench_kernel_t *kernel = &bench_kernels[k];
+                if (!kernel->supported()) {
+                    continue;
+                }
+                if (mode < 4 && kernel->kernel && kernel->kernel != lcd_row_scalar) {
+                    printf("%12s", "-");
+                    continue;
+                }
+                bench_frame(kernel, actual);
+                if (memcmp(expected, actual, sizeof(actual))) {
+                    printf("%12s", "MISMATCH");
+                    ok = false;
+                } else {
+                    printf("%12.0f", bench_time(kernel, actual, seconds));
+                }
+                fflush(stdout);
+            }
+            printf("\n");
+        }
+    }
+
+    free(mem.ram.block);
+    return ok ? 0 : 1;
+}
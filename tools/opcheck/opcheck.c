@@ -0,0 +1,320 @@
+/*
+ * Checks the instruction tables in core/debug/opcodes.c against the CPU emulation. Every instruction in every
+ * table is run through cpu_execute() from RAM in Z80 and ADL mode, with and without each mode suffix, and from
+ * flash in ADL mode so fetches are told apart from data accesses. Conditional instructions are run once with
+ * the condition holding and once without, and block instructions for several counts. The size the tables give
+ * has to match where the CPU went, and opcode_cycles() the cycles it took.
+ *
+ * Usage: opcheck [-v]
+ *   -v         also list the instructions that matched
+ *
+ * Exits with 1 if anything differs, so the tables can't drift from cpu.c unnoticed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../core/asic.h"
+#include "../../core/cpu.h"
+#include "../../core/mem.h"
+#include "../../core/emu.h"
+#include "../../core/control.h"
+#include "../../core/schedule.h"
+#include "../../core/debug/debug.h"
+#include "../../core/debug/opcodes.h"
+
+/* The core calls back into whatever front end it runs under */
+void gui_do_stuff(void) {}
+void gui_entered_send_state(bool entered) { (void)entered; }
+void gui_console_printf(const char *format, ...) { (void)format; }
+void gui_console_err_printf(const char *format, ...) { (void)format; }
+void gui_debugger_raise_or_disable(bool entered) { (void)entered; }
+void gui_debugger_send_command(int reason, uint32_t address) { (void)reason; (void)address; }
+void gui_render_gif_frame(void) {}
+void gui_set_busy(bool busy) { (void)busy; }
+void gui_emu_sleep(void) {}
+void throttle_timer_wait(void) {}
+
+#define CHECK_RAM_CODE   0xD18000
+#define CHECK_FLASH_CODE 0x020000
+#define CHECK_DATA       0xD19000   /* Where pointers and immediate words go */
+#define CHECK_STACK      0xD1A000
+#define CHECK_MEMORY     0x3000     /* Cleared before each run, from CHECK_DATA */
+#define CHECK_OFFSET     0x10       /* Index offsets and relative jumps */
+#define CHECK_RETURN     0x200      /* Where returns go, from the start of the instruction */
+#define CHECK_ROUNDS     1024
+
+typedef struct {
+    const char *name;
+    const opcode_t *table;
+    uint8_t prefix[2];
+    uint8_t prefix_size;
+    bool offset_first;              /* The index offset comes before the opcode */
+} check_page_t;
+
+static const check_page_t check_pages[] = {
+    { "",      opcode_main,     { 0 },          0, false },
+    { "cb",    opcode_cb,       { 0xCB },       1, false },
+    { "ed",    opcode_ed,       { 0xED },       1, false },
+    { "dd",    opcode_index,    { 0xDD },       1, false },
+    { "fd",    opcode_index,    { 0xFD },       1, false },
+    { "ddcb",  opcode_index_cb, { 0xDD, 0xCB }, 2, true },
+    { "fdcb",  opcode_index_cb, { 0xFD, 0xCB }, 2, true },
+};
+
+typedef struct {
+    const char *name;
+    uint32_t code;
+    bool adl;
+    uint8_t suffix;                 /* 0 for none */
+} check_config_t;
+
+static const check_config_t check_configs[] = {
+    { "z80 ram",       CHECK_RAM_CODE,   false, 0 },
+    { "z80 ram .sis",  CHECK_RAM_CODE,   false, 0x40 },
+    { "z80 ram .lis",  CHECK_RAM_CODE,   false, 0x49 },
+    { "z80 ram .sil",  CHECK_RAM_CODE,   false, 0x52 },
+    { "z80 ram .lil",  CHECK_RAM_CODE,   false, 0x5B },
+    { "adl ram",       CHECK_RAM_CODE,   true,  0 },
+    { "adl ram .sis",  CHECK_RAM_CODE,   true,  0x40 },
+    { "adl ram .lis",  CHECK_RAM_CODE,   true,  0x49 },
+    { "adl ram .sil",  CHECK_RAM_CODE,   true,  0x52 },
+    { "adl ram .lil",  CHECK_RAM_CODE,   true,  0x5B },
+    { "adl flash",     CHECK_FLASH_CODE, true,  0 },
+};
+
+/* Register values a run starts from: flags and BC decide conditions and block instruction counts */
+typedef struct {
+    uint8_t f;
+    uint32_t bc;
+} check_setup_t;
+
+static const check_setup_t check_plain[] = { { 0x00, CHECK_DATA + 0x800 } };
+static const check_setup_t check_conditional[] = { { 0x00, 0xD10100 }, { 0xFF, 0xD10200 } };
+static const check_setup_t check_block[] = { { 0x00, 0x000101 }, { 0x00, 0x000202 }, { 0x00, 0x000301 } };
+
+static bool verbose;
+static unsigned int checked, skipped, failed;
+
+static uint8_t *check_pointer(uint32_t address) {
+    return address >= 0xD00000 ? mem.ram.block + (address - 0xD00000) : mem.flash.block + address;
+}
+
+static uint8_t check_read(void *context, uint32_t address) {
+    (void)context;
+    return *check_pointer(address);
+}
+
+static void check_put_word(uint32_t address, uint32_t value) {
+    uint8_t *ptr = check_pointer(address);
+    ptr[0] = (uint8_t)value;
+    ptr[1] = (uint8_t)(value >> 8);
+    ptr[2] = (uint8_t)(value >> 16);
+}
+
+/* Where the CPU takes an address to, in the mode given, with MBASE selecting the code's 64K */
+static uint32_t check_address(uint32_t value, bool mode, uint32_t code) {
+    return mode ? value & 0xFFFFFF : (code & 0xFF0000) | (value & 0xFFFF);
+}
+
+/* The bytes of the instruction at opcode in page, with operands that point into RAM where they can */
+static uint32_t check_encode(uint8_t *out, const check_config_t *config, const check_page_t *page, uint8_t op) {
+    const opcode_t *opcode = &page->table[op];
+    bool il = config->suffix ? config->suffix >> 1 & 1 : config->adl;
+    uint32_t size = 0;
+
+    if (config->suffix) {
+        out[size++] = config->suffix;
+    }
+    memcpy(out + size, page->prefix, page->prefix_size);
+    size += page->prefix_size;
+    if (page->offset_first) {
+        out[size++] = CHECK_OFFSET;
+    }
+    out[size++] = op;
+
+    switch (opcode->kind) {
+        case OPCODE_BYTE:
+            out[size++] = 0x00;
+            break;
+        case OPCODE_OFFSET:
+        case OPCODE_RELATIVE:
+            out[size++] = CHECK_OFFSET;
+            break;
+        case OPCODE_OFFSET_BYTE:
+            out[size++] = CHECK_OFFSET;
+            out[size++] = 0x00;
+            break;
+        case OPCODE_WORD:
+            out[size++] = (uint8_t)CHECK_DATA;
+            out[size++] = (uint8_t)(CHECK_DATA >> 8);
+            if (il) {
+                out[size++] = (uint8_t)(CHECK_DATA >> 16);
+            }
+            break;
+        default:
+            break;
+    }
+    return size;
+}
+
+static void check_run(const check_config_t *config, const check_page_t *page, uint8_t op,
+                      const check_setup_t *setup, bool *outcomes) {
+    eZ80registers_t *r = &cpu.registers;
+    uint8_t bytes[8];
+    uint32_t size = check_encode(bytes, config, page, op);
+    uint32_t code = config->code;
+    uint32_t fallthrough, ret = code + CHECK_RETURN;
+    uint32_t pointer, expected, rounds = 0;
+    opcode_inst_t inst;
+    bool taken = false, pc_ok = true;
+    const opcode_t *opcode;
+
+    memset(check_pointer(CHECK_DATA), 0, CHECK_MEMORY);
+    memset(check_pointer(code), 0, CHECK_RETURN + 0x100);
+    memcpy(check_pointer(code), bytes, size);
+    opcode_decode(&inst, code, config->adl, check_read, NULL);
+    opcode = inst.opcode;
+    if (opcode->flow == OPCODE_FLOW_TRAP) {
+        skipped++;
+        return;
+    }
+
+    /* Indirect jumps and returns go back into the code, so their target costs what the tables take it to */
+    pointer = opcode->flow == OPCODE_FLOW_INDIRECT ? ret : CHECK_DATA;
+    check_put_word(CHECK_STACK, ret);
+    check_put_word(CHECK_STACK + 0x800, ret);
+    if (config->suffix) {
+        /* Suffixed returns take the mode first, and in Z80 mode only the low address bytes from the short stack */
+        *check_pointer(CHECK_STACK) = config->adl;
+        check_put_word(config->adl ? CHECK_STACK + 1 : CHECK_STACK + 0x800, ret);
+    }
+
+    memset(r, 0, sizeof(*r));
+    r->A = 0x55;
+    r->F = setup->f;
+    r->BC = setup->bc;
+    r->DE = CHECK_DATA + 0x1000;
+    r->HL = pointer;
+    r->IX = opcode->flow == OPCODE_FLOW_INDIRECT ? pointer : pointer - CHECK_OFFSET;
+    r->IY = r->IX;
+    r->SPL = CHECK_STACK;
+    r->SPS = (CHECK_STACK + 0x800) & 0xFFFF;
+    r->MBASE = code >> 16;
+    cpu.MADL = cpu.IEF1 = cpu.IEF2 = cpu.IEF_wait = cpu.halted = cpu.NMI = 0;
+    cpu.IM = 1;
+    cpu_flush(code, config->adl);
+
+    /* One round at a time, so block instructions can be counted */
+    cpu.cycles = 0;
+    do {
+        cpu.next = cpu.cycles + 1;
+        cpu_execute();
+        rounds++;
+    } while (cpu.inBlock && rounds < CHECK_ROUNDS);
+    cpu.inBlock = cpu.halted = 0;
+
+    fallthrough = check_address(code + inst.size, config->adl, code);
+    if (opcode->flags & OPCODE_REPEAT) {
+        expected = opcode_cycles(&inst, code, false) + (rounds - 1) * opcode_cycles(&inst, code, true);
+        pc_ok = r->PC == fallthrough;
+    } else {
+        if (opcode->flow != OPCODE_FLOW_NEXT) {
+            taken = !(opcode->flags & OPCODE_CONDITIONAL) || r->PC != fallthrough;
+        }
+        expected = opcode_cycles(&inst, code, (opcode->flags & OPCODE_CONDITIONAL) && taken);
+        if (!taken) {
+            pc_ok = r->PC == fallthrough;
+        } else if (opcode->kind == OPCODE_RELATIVE) {
+            pc_ok = r->PC == check_address(inst.l ? inst.word : inst.word & 0xFFFF, config->adl, code);
+        } else if (opcode->kind == OPCODE_RESTART || (opcode->kind == OPCODE_WORD && opcode->flow == OPCODE_FLOW_CALL)) {
+            pc_ok = r->PC == check_address(inst.word, inst.il, code);
+        } else if (opcode->kind == OPCODE_WORD) {
+            pc_ok = r->PC == check_address(inst.word, inst.l, code);
+        } else if (opcode->flow == OPCODE_FLOW_RETURN || opcode->flow == OPCODE_FLOW_INDIRECT) {
+            pc_ok = r->PC == ret;
+        }
+        outcomes[taken] = true;
+    }
+
+    checked++;
+    if (!pc_ok || (uint32_t)cpu.cycles != expected) {
+        failed++;
+    } else if (!verbose) {
+        return;
+    }
+    printf("%-13s %-5s %02X  %-6s %-12s", config->name, page->name, op, opcode->mnemonic, opcode->operands);
+    if (opcode->flags & OPCODE_REPEAT) {
+        printf(" %4u rounds", rounds);
+    } else if (opcode->flags & OPCODE_CONDITIONAL) {
+        printf(" %-11s", taken ? "taken" : "not taken");
+    } else {
+        printf(" %-11s", "");
+    }
+    printf("  size %u%s  cycles %u, cpu %u\n", inst.size, pc_ok ? "" : " but cpu went elsewhere",
+           expected, (unsigned int)cpu.cycles);
+}
+
+int main(int argc, char **argv) {
+    const unsigned int configs = sizeof(check_configs) / sizeof(check_configs[0]);
+    const unsigned int pages = sizeof(check_pages) / sizeof(check_pages[0]);
+    unsigned int c, p, op;
+
+    if (argc > 2 || (argc == 2 && strcmp(argv[1], "-v"))) {
+        fprintf(stderr, "usage: %s [-v]\n", argv[0]);
+        return 2;
+    }
+    verbose = argc == 2;
+
+    sched_reset();
+    sched.items[SCHED_THROTTLE].clock = CLOCK_27M;
+    sched.items[SCHED_THROTTLE].proc = throttle_interval_event;
+    asic_init();
+    debugger_init();
+    asic_reset();
+    sched_update_next_event();
+    /* Port writes go nowhere and flash writes don't fault, so nothing the instructions do reaches the hardware */
+    memset(debugger.data.ports, DBG_PORT_FREEZE, 0x10000);
+    control.privileged = 0xFFFFFF;
+
+    for (c = 0; c < configs; c++) {
+        for (p = 0; p < pages; p++) {
+            for (op = 0; op < 0x100; op++) {
+                const opcode_t *opcode = &check_pages[p].table[op];
+                const check_setup_t *setups = check_plain;
+                unsigned int count = 1, i;
+                bool outcomes[2] = { false, false };
+
+                if (opcode->kind == OPCODE_PREFIX || opcode->kind == OPCODE_SUFFIX) {
+                    continue;
+                }
+                /* The emulator's own flash erase takes hl as an offset into flash, not an address */
+                if (check_pages[p].table == opcode_ed && op == 0xEE) {
+                    continue;
+                }
+                if (opcode->flags & OPCODE_REPEAT) {
+                    setups = check_block;
+                    count = sizeof(check_block) / sizeof(check_block[0]);
+                } else if (opcode->flags & OPCODE_CONDITIONAL) {
+                    setups = check_conditional;
+                    count = sizeof(check_conditional) / sizeof(check_conditional[0]);
+                }
+                for (i = 0; i < count; i++) {
+                    check_run(&check_configs[c], &check_pages[p], (uint8_t)op, &setups[i], outcomes);
+                }
+                if ((opcode->flags & (OPCODE_CONDITIONAL | OPCODE_REPEAT)) == OPCODE_CONDITIONAL &&
+                    opcode->flow != OPCODE_FLOW_TRAP && !(outcomes[0] && outcomes[1])) {
+                    printf("%-13s %-5s %02X  %-6s %-12s  only ran %s\n", check_configs[c].name, check_pages[p].name,
+                           op, opcode->mnemonic, opcode->operands, outcomes[1] ? "taken" : "not taken");
+                    failed++;
+                }
+            }
+        }
+    }
+
+    printf("%u runs checked, %u traps skipped, %u differ\n", checked, skipped, failed);
+    asic_free();
+    debugger_free();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,282 @@
+/*
+ * Disassembles an instruction trace saved by CEmu, one instruction per line:
+ *
+ *   cycle  pc  mode  cycles  instruction  ; writes
+ *
+ * Usage: tracedecode [-n count] trace
+ *   -n count   only show the last count instructions
+ *
+ * The code is disassembled from the memory saved with the trace, as it was when the trace was saved.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../core/cpu.h"
+#include "../../core/debug/opcodes.h"
+#include "../../core/debug/trace.h"
+
+#define MEMORY_SIZE 0x1000000
+
+static uint8_t *memory;
+
+/* The trace has the cycles each instruction really took, so nothing asks what memory costs or where MBASE is */
+eZ80cpu_t cpu;
+
+uint32_t mem_access_cycles(uint32_t address, bool write) {
+    (void)address;
+    (void)write;
+    return 0;
+}
+
+static uint8_t memory_read(void *context, uint32_t address) {
+    (void)context;
+    return memory[address & (MEMORY_SIZE - 1)];
+}
+
+static bool get32(FILE *file, uint32_t *value) {
+    uint8_t bytes[4];
+    if (fread(bytes, 1, sizeof(bytes), file) != sizeof(bytes)) {
+        return false;
+    }
+    *value = bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+    return true;
+}
+
+static bool get64(FILE *file, uint64_t *value) {
+    uint32_t low, high;
+    if (!get32(file, &low) || !get32(file, &high)) {
+        return false;
+    }
+    *value = (uint64_t)high << 32 | low;
+    return true;
+}
+
+static const uint8_t *varint(const uint8_t *in, const uint8_t *end, uint64_t *value) {
+    unsigned int shift = 0;
+    *value = 0;
+    while (in < end && shift < 64) {
+        uint8_t byte = *in++;
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return in;
+        }
+        shift += 7;
+    }
+    return NULL;
+}
+
+/* An instruction is shown once the next one starts, when it is known how long it took */
+static struct {
+    bool valid;
+    bool show;
+    bool interrupt;                 /* Taken just before it */
+    bool pending;                   /* Taken before the next one, which can be in the next chunk */
+    bool adl;
+    uint32_t pc;
+    uint64_t cycle;
+    uint32_t writes;
+    uint32_t write_address[TRACE_WRITES];
+    uint8_t write_value[TRACE_WRITES];
+    uint64_t dropped;
+} held;
+
+static void show_held(bool known, uint64_t next) {
+    opcode_inst_t inst;
+    char operands[128];
+    uint32_t i;
+
+    if (!held.valid || !held.show) {
+        return;
+    }
+    if (held.interrupt) {
+        printf("%12llu  interrupt\n", (unsigned long long)held.cycle);
+    }
+    opcode_decode(&inst, held.pc, held.adl, memory_read, NULL);
+    opcode_operands(&inst, operands, sizeof(operands), NULL, NULL);
+    printf("%12llu  %06X  %s  ", (unsigned long long)held.cycle, held.pc, held.adl ? "adl" : "z80");
+    if (known) {
+        printf("%5llu", (unsigned long long)(next - held.cycle));
+    } else {
+        printf("%5s", "-");
+    }
+    printf("  %s%s%s", inst.opcode->mnemonic, inst.suffix ? opcode_suffixes[inst.il << 1 | inst.l] : " ", operands);
+    for (i = 0; i < held.writes; i++) {
+        printf("%s%06X=%02X", i ? " " : "  ; ", held.write_address[i], held.write_value[i]);
+    }
+    if (held.dropped) {
+        printf(" and %llu more", (unsigned long long)held.dropped);
+    }
+    putchar('\n');
+}
+
+/* Shows the instructions of a chunk from the skip-th on; false if the records don't make sense */
+static bool decode_chunk(const uint8_t *in, const uint8_t *end, uint64_t cycle, uint64_t skip) {
+    uint32_t pc = 0;
+
+    while (in < end) {
+        uint8_t tag = *in++;
+        uint64_t cycles = tag & TRACE_TAG_CYCLES;
+
+        switch (tag & TRACE_TAG_PC) {
+            case TRACE_PC_BYTE:
+                if (end - in < 1) {
+                    return false;
+                }
+                pc = (pc + (int8_t)in[0]) & 0xFFFFFF;
+                in += 1;
+                break;
+            case TRACE_PC_WORD:
+                if (end - in < 2) {
+                    return false;
+                }
+                pc = (pc + (int16_t)(in[0] | in[1] << 8)) & 0xFFFFFF;
+                in += 2;
+                break;
+            case TRACE_PC_LONG:
+                if (end - in < 3) {
+                    return false;
+                }
+                pc = in[0] | in[1] << 8 | in[2] << 16;
+                in += 3;
+                break;
+            default:
+                switch (tag) {
+                    case TRACE_MARK_WRITE:
+                        if (end - in < 4) {
+                            return false;
+                        }
+                        if (held.writes < TRACE_WRITES) {
+                            held.write_address[held.writes] = in[0] | in[1] << 8 | in[2] << 16;
+                            held.write_value[held.writes++] = in[3];
+                        }
+                        in += 4;
+                        break;
+                    case TRACE_MARK_DROPPED:
+                        if (!(in = varint(in, end, &held.dropped))) {
+                            return false;
+                        }
+                        break;
+                    case TRACE_MARK_INTERRUPT:
+                        held.pending = true;
+                        break;
+                    default:
+                        return false;
+                }
+                continue;
+        }
+        if (cycles == TRACE_CYCLES_MORE) {
+            if (!(in = varint(in, end, &cycles))) {
+                return false;
+            }
+            cycles += TRACE_CYCLES_MORE;
+        }
+
+        cycle += cycles;
+        show_held(true, cycle);
+        held.valid = true;
+        held.show = !skip;
+        held.interrupt = held.pending;
+        held.adl = tag & TRACE_TAG_ADL;
+        held.pc = pc;
+        held.cycle = cycle;
+        held.writes = 0;
+        held.dropped = 0;
+        held.pending = false;
+        if (skip) {
+            skip--;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    char magic[TRACE_MAGIC_SIZE];
+    unsigned long long last = 0;
+    uint64_t total = 0, skip;
+    uint32_t chunks, pages, i;
+    long records;
+    const char *path = NULL;
+    FILE *file;
+    int arg;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+            last = strtoull(argv[++arg], NULL, 0);
+        } else if (!path) {
+            path = argv[arg];
+        } else {
+            path = NULL;
+            break;
+        }
+    }
+    if (!path) {
+        fprintf(stderr, "usage: %s [-n count] trace\n", argv[0]);
+        return 2;
+    }
+    if (!(file = fopen(path, "rb"))) {
+        perror(path);
+        return 1;
+    }
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_SIZE) ||
+        !get32(file, &chunks)) {
+        fprintf(stderr, "%s: not a CEmu trace\n", path);
+        return 1;
+    }
+
+    /* The code comes after the records, so find it first and count the instructions on the way */
+    records = ftell(file);
+    for (i = 0; i < chunks; i++) {
+        uint64_t start;
+        uint32_t count, size;
+        if (!get64(file, &start) || !get32(file, &count) || !get32(file, &size) || fseek(file, size, SEEK_CUR)) {
+            fprintf(stderr, "%s: truncated\n", path);
+            return 1;
+        }
+        total += count;
+    }
+    if (!(memory = calloc(MEMORY_SIZE, 1))) {
+        fputs("out of memory\n", stderr);
+        return 1;
+    }
+    if (!get32(file, &pages)) {
+        fprintf(stderr, "%s: truncated\n", path);
+        return 1;
+    }
+    for (i = 0; i < pages; i++) {
+        uint32_t address;
+        if (!get32(file, &address) || address > MEMORY_SIZE - TRACE_PAGE_SIZE ||
+            fread(memory + address, 1, TRACE_PAGE_SIZE, file) != TRACE_PAGE_SIZE) {
+            fprintf(stderr, "%s: truncated\n", path);
+            return 1;
+        }
+    }
+
+    skip = last && last < total ? total - last : 0;
+    fseek(file, records, SEEK_SET);
+    for (i = 0; i < chunks; i++) {
+        static uint8_t data[TRACE_CHUNK_SIZE];
+        uint64_t start;
+        uint32_t count, size;
+        get64(file, &start);
+        get32(file, &count);
+        get32(file, &size);
+        if (skip >= count) {
+            skip -= count;
+            fseek(file, size, SEEK_CUR);
+            continue;
+        }
+        if (size > sizeof(data) || fread(data, 1, size, file) != size || !decode_chunk(data, data + size, start, skip)) {
+            fprintf(stderr, "%s: chunk %u is corrupt\n", path, i);
+            return 1;
+        }
+        skip = 0;
+    }
+    /* The last one was still running */
+    show_held(false, 0);
+
+    free(memory);
+    fclose(file);
+    return 0;
+}